@@ -0,0 +1,42 @@
+/*!
+  \file
+  \brief Shared helpers for benchmark executables.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+using clock = std::chrono::steady_clock;
+
+/// \brief Keep \p value alive so the compiler cannot drop the computation producing it.
+template <class T> inline void do_not_optimize(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/// \return Seconds elapsed since \p start.
+inline double seconds_since(clock::time_point start) noexcept {
+    return std::chrono::duration<double>(clock::now() - start).count();
+}
+
+/// \brief Print one result row: name, throughput in MiB/s and operations per second.
+inline void report(const char* name, std::size_t bytes, std::size_t operations, double seconds) noexcept {
+    const double mib{static_cast<double>(bytes) / (1024.0 * 1024.0)};
+    std::printf("%-40s %10.1f MiB/s %14.0f ops/s %8.3f s\n", name, mib / seconds,
+                static_cast<double>(operations) / seconds, seconds);
+}
+
+} // namespace bench
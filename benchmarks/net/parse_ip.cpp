@@ -0,0 +1,100 @@
+/*!
+  \file
+  \brief Address classification and literal parsing benchmark.
+
+  \details
+  Classifies a mix of IPv4, IPv6, hostname and malformed inputs, once with
+  the previous `inet_pton(AF_INET)` then `inet_pton(AF_INET6)` probe chain
+  and once with `parse_ip`, then runs `detect_address_kind` and literal
+  `resolve` over the same mix.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <array>
+#include <cstdlib>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <sfap/net/address_kind.hpp>
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/resolve.hpp>
+
+#include "common.hpp"
+
+namespace {
+
+/// \brief Roughly what a service manifest contains: mostly IPv4, some IPv6 and names, a few typos.
+constexpr std::array<const char*, 16> inputs{
+    "10.12.0.7",
+    "192.168.100.254",
+    "172.16.3.1",
+    "203.0.113.42",
+    "8.8.8.8",
+    "127.0.0.1",
+    "2001:db8:85a3::8a2e:370:7334",
+    "fe80::1ff:fe23:4567:890a",
+    "::1",
+    "::ffff:10.0.0.1",
+    "api.internal.example.com",
+    "db-primary.svc",
+    "cache01.eu-west.example.net",
+    "10.0.0.256",
+    "2001:db8:::1",
+    "not an address",
+};
+
+template <class Classify> void run(const char* name, std::size_t rounds, Classify classify) {
+    std::size_t bytes{};
+    for (const char* input : inputs)
+        bytes += std::strlen(input);
+
+    std::size_t sink{};
+    const auto begin{bench::clock::now()};
+    for (std::size_t r = 0; r < rounds; ++r)
+        for (const char* input : inputs)
+            sink += classify(input);
+    bench::report(name, bytes * rounds, inputs.size() * rounds, bench::seconds_since(begin));
+    bench::do_not_optimize(sink);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t rounds{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000};
+
+    run("inet_pton v4 then v6", rounds, [](const char* input) -> std::size_t {
+        alignas(in6_addr) std::array<unsigned char, sizeof(in6_addr)> sink;
+        if (::inet_pton(AF_INET, input, sink.data()) == 1)
+            return 4 + sink[3];
+        if (::inet_pton(AF_INET6, input, sink.data()) == 1)
+            return 6 + sink[15];
+        return 0;
+    });
+
+    run("parse_ip", rounds, [](const char* input) -> std::size_t {
+        const auto ip = sfap::net::parse_ip(input);
+        return ip ? ip->size() + ip->data()[ip->size() - 1] : 0;
+    });
+
+    run("detect_address_kind", rounds, [](const char* input) -> std::size_t {
+        return static_cast<std::size_t>(*sfap::net::detect_address_kind(input));
+    });
+
+    run("resolve (literals only)", rounds / 10, [](const char* input) -> std::size_t {
+        if (!sfap::net::parse_ip(input))
+            return 0;
+        const auto ip = sfap::net::resolve(input);
+        return ip ? ip->size() : 0;
+    });
+
+    return 0;
+}
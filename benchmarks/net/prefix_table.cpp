@@ -0,0 +1,108 @@
+/*!
+  \file
+  \brief PrefixTable build and lookup benchmark.
+
+  \details
+  Builds a table from a routing-table-like mix of prefixes (mostly IPv4 /24
+  and shorter, some longer, plus IPv6 /32-/64 under a few allocations) and
+  measures longest-prefix-match lookups per second for addresses taken from
+  the table and for uniformly random addresses.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <sfap/net/prefix_table.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/memory.hpp>
+
+#include "common.hpp"
+
+namespace {
+
+using sfap::net::ip4_t;
+using sfap::net::ip6_t;
+using sfap::net::ipx_t;
+
+std::uint8_t ip4_length(std::mt19937& rng) {
+    const unsigned roll{static_cast<unsigned>(rng() % 100)};
+    if (roll < 55)
+        return 24;
+    if (roll < 85)
+        return static_cast<std::uint8_t>(17 + rng() % 7);
+    if (roll < 95)
+        return static_cast<std::uint8_t>(8 + rng() % 9);
+    return static_cast<std::uint8_t>(25 + rng() % 8);
+}
+
+ipx_t random_ip4(std::mt19937& rng) {
+    const std::uint32_t bits{static_cast<std::uint32_t>(rng())};
+    return ipx_t{ip4_t{static_cast<std::uint8_t>(bits >> 24), static_cast<std::uint8_t>(bits >> 16),
+                       static_cast<std::uint8_t>(bits >> 8), static_cast<std::uint8_t>(bits)}};
+}
+
+ipx_t random_ip6(std::mt19937& rng, unsigned allocations) {
+    ip6_t bytes{0x20, 0x01};
+    for (std::size_t i = 2; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::uint8_t>(rng());
+    bytes[2] = static_cast<std::uint8_t>(rng() % allocations);
+    return ipx_t{bytes};
+}
+
+template <class Lookup>
+void run(const char* name, const std::vector<ipx_t>& probes, std::size_t rounds, Lookup lookup) {
+    std::size_t hits{};
+    const auto begin{bench::clock::now()};
+    for (std::size_t r = 0; r < rounds; ++r)
+        for (const auto& probe : probes)
+            hits += lookup(probe);
+    const double seconds{bench::seconds_since(begin)};
+    bench::report(name, probes.size() * rounds * sizeof(ipx_t), probes.size() * rounds, seconds);
+    std::printf("%-40s %10.1f%% matched\n", "", 100.0 * static_cast<double>(hits) / (probes.size() * rounds));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000};
+    const std::size_t rounds{argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5};
+    const std::size_t ip6_count{count / 10};
+
+    std::mt19937 rng{42};
+    std::vector<ipx_t> inside;
+    sfap::net::PrefixTable::Builder builder;
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool v6{i < ip6_count};
+        const ipx_t address{v6 ? random_ip6(rng, 16) : random_ip4(rng)};
+        const auto length{v6 ? static_cast<std::uint8_t>(32 + rng() % 17) : ip4_length(rng)};
+        builder.add(address, length, static_cast<std::uint32_t>(i % 2));
+        if (i % 4 == 0)
+            inside.push_back(address);
+    }
+
+    const auto begin{bench::clock::now()};
+    auto table = builder.build({.pages = sfap::MemoryOptions::Pages::TRANSPARENT_HUGE});
+    if (!table)
+        return 1;
+    std::printf("built %zu prefixes (%zu IPv6) in %.3f s, %.1f MiB of nodes\n", table->size(), ip6_count,
+                bench::seconds_since(begin), static_cast<double>(table->memory_usage()) / (1024.0 * 1024.0));
+
+    std::vector<ipx_t> random;
+    for (std::size_t i = 0; i < inside.size(); ++i)
+        random.push_back(i % 10 == 0 ? random_ip6(rng, 256) : random_ip4(rng));
+
+    const auto lookup = [&](const ipx_t& ip) -> std::size_t { return table->lookup(ip).has_value(); };
+    run("lookup, addresses from table", inside, rounds, lookup);
+    run("lookup, random addresses", random, rounds, lookup);
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*!
+  \file
+  \brief Buffer::find throughput benchmark.
+
+  \details
+  Scans a large buffer of HTTP-like header text for a byte and for a pattern
+  that only occur at the very end, with `std::find`/`std::search` (the
+  previous implementation) as the baseline.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include <sfap/utils/buffer.hpp>
+
+#include "common.hpp"
+
+namespace {
+
+/// \brief Run \p scan \p rounds times over \p bytes and report throughput.
+template <class Scan> void run(const char* name, std::size_t bytes, std::size_t rounds, Scan scan) {
+    std::size_t sink{};
+    const auto begin{bench::clock::now()};
+    for (std::size_t i = 0; i < rounds; ++i)
+        sink += scan();
+    bench::report(name, bytes * rounds, rounds, bench::seconds_since(begin));
+    bench::do_not_optimize(sink);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t size{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{8} << 20};
+    const std::size_t rounds{argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50};
+
+    constexpr std::string_view line{"X-Forwarded-For: 203.0.113.7, 198.51.100.23\r\n"};
+    constexpr std::string_view terminator{"\r\n\r\n"};
+
+    sfap::Buffer buffer{size};
+    if (!buffer || size < terminator.size())
+        return 1;
+    buffer.resize(size);
+    for (std::size_t i = 0; i < size; ++i)
+        buffer[i] = static_cast<std::byte>(line[i % line.size()]);
+    std::memcpy(buffer.data() + size - terminator.size(), terminator.data(), terminator.size());
+    buffer[size - terminator.size() - 1] = std::byte{'|'};
+
+    const std::span<const std::byte> pattern{reinterpret_cast<const std::byte*>(terminator.data()),
+                                             terminator.size()};
+    const sfap::Buffer& view{buffer};
+
+    std::printf("%zu byte buffer, %zu rounds\n", size, rounds);
+
+    run("std::find byte", size, rounds,
+        [&] { return static_cast<std::size_t>(std::find(view.begin(), view.end(), std::byte{'|'}) - view.begin()); });
+    run("Buffer::find byte", size, rounds, [&] { return view.find(std::byte{'|'}).value_or(0); });
+    run("std::search \\r\\n\\r\\n", size, rounds, [&] {
+        return static_cast<std::size_t>(std::search(view.begin(), view.end(), pattern.begin(), pattern.end()) -
+                                        view.begin());
+    });
+    run("Buffer::find \\r\\n\\r\\n", size, rounds, [&] { return view.find(pattern).value_or(0); });
+
+    return 0;
+}
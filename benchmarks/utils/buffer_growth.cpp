@@ -0,0 +1,63 @@
+/*!
+  \file
+  \brief Growable Buffer append benchmark.
+
+  \details
+  Appends fixed-size chunks until the buffer holds the target size, once with
+  a growable buffer (realloc, then mremap above the page threshold) and once
+  by allocating a twice-as-large fixed buffer and copying whenever it is full.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <cstdlib>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdio>
+
+#include <sfap/utils/buffer.hpp>
+
+#include "common.hpp"
+
+int main(int argc, char** argv) {
+    const std::size_t total{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{256} << 20};
+    const std::size_t rounds{argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5};
+    const std::vector<std::byte> chunk(16 * 1024, std::byte{0x5A});
+
+    std::printf("%zu bytes in %zu byte chunks, %zu rounds\n", total, chunk.size(), rounds);
+
+    {
+        const auto begin{bench::clock::now()};
+        for (std::size_t r = 0; r < rounds; ++r) {
+            sfap::Buffer fixed{chunk.size()};
+            while (fixed.size() < total) {
+                if (fixed.free() < chunk.size()) {
+                    sfap::Buffer larger{fixed.capacity() * 2};
+                    larger.assign(fixed.view());
+                    fixed = std::move(larger);
+                }
+                fixed.append(chunk);
+            }
+            bench::do_not_optimize(fixed.data()[total - 1]);
+        }
+        bench::report("fixed Buffer + copy on full", total * rounds, rounds, bench::seconds_since(begin));
+    }
+
+    {
+        const auto begin{bench::clock::now()};
+        for (std::size_t r = 0; r < rounds; ++r) {
+            sfap::Buffer growable{sfap::growable, chunk.size()};
+            while (growable.size() < total)
+                growable.append(chunk);
+            bench::do_not_optimize(growable.data()[total - 1]);
+        }
+        bench::report("growable Buffer", total * rounds, rounds, bench::seconds_since(begin));
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+/*!
+  \file
+  \brief Cross-thread SPSC throughput benchmark for RingBuffer.
+
+  \details
+  One producer thread and one consumer thread move a fixed volume of bytes
+  through the ring, either byte by byte (`put()`/`pop()`) or in batches via
+  `prepare_*`/`commit_*`. A reference ring with the index layout used before
+  the cache-line split (adjacent atomics, opposite index loaded on every call)
+  runs the same workload for comparison.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/utils/ringbuffer.hpp>
+
+#include "common.hpp"
+
+namespace {
+
+/// \brief Previous layout: both indices on one cache line, no cached copies.
+class ReferenceRing {
+  public:
+    explicit ReferenceRing(std::size_t n) : data_(std::make_unique<std::byte[]>(n)), mask_(n - 1) {}
+
+    bool put(std::byte c) noexcept {
+        const std::size_t t{tail_.load(std::memory_order_acquire)};
+        const std::size_t h{head_.load(std::memory_order_relaxed)};
+        if (h - t == mask_ + 1)
+            return false;
+        data_[h & mask_] = c;
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(std::byte& c) noexcept {
+        const std::size_t h{head_.load(std::memory_order_acquire)};
+        const std::size_t t{tail_.load(std::memory_order_relaxed)};
+        if (h == t)
+            return false;
+        c = data_[t & mask_];
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t write(const std::byte* src, std::size_t n) noexcept {
+        const std::size_t t{tail_.load(std::memory_order_acquire)};
+        const std::size_t h{head_.load(std::memory_order_relaxed)};
+        const std::size_t take{std::min(n, mask_ + 1 - (h - t))};
+        const std::size_t first{std::min(take, mask_ + 1 - (h & mask_))};
+        std::copy_n(src, first, data_.get() + (h & mask_));
+        std::copy_n(src + first, take - first, data_.get());
+        head_.store(h + take, std::memory_order_release);
+        return take;
+    }
+
+    std::size_t read(std::byte* dst, std::size_t n) noexcept {
+        const std::size_t h{head_.load(std::memory_order_acquire)};
+        const std::size_t t{tail_.load(std::memory_order_relaxed)};
+        const std::size_t take{std::min(n, h - t)};
+        const std::size_t first{std::min(take, mask_ + 1 - (t & mask_))};
+        std::copy_n(data_.get() + (t & mask_), first, dst);
+        std::copy_n(data_.get(), take - first, dst + first);
+        tail_.store(t + take, std::memory_order_release);
+        return take;
+    }
+
+  private:
+    std::unique_ptr<std::byte[]> data_;
+    std::size_t mask_;
+    std::atomic<std::size_t> head_{};
+    std::atomic<std::size_t> tail_{};
+};
+
+std::size_t copy_in(sfap::RingBuffer::InputView view, const std::byte* src) noexcept {
+    std::copy_n(src, view.first.size(), view.first.data());
+    std::copy_n(src + view.first.size(), view.second.size(), view.second.data());
+    return sfap::RingBuffer::view_size(view);
+}
+
+std::size_t copy_out(sfap::RingBuffer::OutputView view, std::byte* dst) noexcept {
+    std::copy_n(view.first.data(), view.first.size(), dst);
+    std::copy_n(view.second.data(), view.second.size(), dst + view.first.size());
+    return sfap::RingBuffer::view_size(view);
+}
+
+/// \brief Run \p produce and \p consume on two threads until \p total bytes passed through.
+template <class Produce, class Consume>
+void run(const char* name, std::size_t total, std::size_t operations, Produce produce, Consume consume) {
+    std::barrier start{3};
+
+    std::thread producer([&] {
+        start.arrive_and_wait();
+        for (std::size_t done = 0; done < total;)
+            done += produce(total - done);
+    });
+
+    std::thread consumer([&] {
+        start.arrive_and_wait();
+        for (std::size_t done = 0; done < total;)
+            done += consume(total - done);
+    });
+
+    start.arrive_and_wait();
+    const auto begin{bench::clock::now()};
+    producer.join();
+    consumer.join();
+    bench::report(name, total, operations, bench::seconds_since(begin));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t total{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 28};
+    constexpr std::size_t capacity{std::size_t{1} << 16};
+    constexpr std::size_t batch{4096};
+
+    std::printf("%zu bytes through a %zu byte ring\n", total, capacity);
+
+    {
+        ReferenceRing ring{capacity};
+        std::byte sink{};
+        run(
+            "reference put/pop", total / 16, total / 16,
+            [&](std::size_t) { return ring.put(std::byte{1}) ? std::size_t{1} : std::size_t{0}; },
+            [&](std::size_t) { return ring.pop(sink) ? std::size_t{1} : std::size_t{0}; });
+        bench::do_not_optimize(sink);
+    }
+
+    {
+        sfap::RingBuffer ring{capacity};
+        std::byte sink{};
+        run(
+            "RingBuffer put/pop", total / 16, total / 16,
+            [&](std::size_t) { return ring.put(std::byte{1}) ? std::size_t{1} : std::size_t{0}; },
+            [&](std::size_t) { return ring.pop(sink) ? std::size_t{1} : std::size_t{0}; });
+        bench::do_not_optimize(sink);
+    }
+
+    {
+        ReferenceRing ring{capacity};
+        auto src{std::make_unique<std::byte[]>(batch)};
+        auto dst{std::make_unique<std::byte[]>(batch)};
+        run(
+            "reference batch 4096", total, total / batch,
+            [&](std::size_t left) { return ring.write(src.get(), std::min(left, batch)); },
+            [&](std::size_t left) { return ring.read(dst.get(), std::min(left, batch)); });
+        bench::do_not_optimize(dst[0]);
+    }
+
+    {
+        sfap::RingBuffer ring{capacity};
+        auto src{std::make_unique<std::byte[]>(batch)};
+        auto dst{std::make_unique<std::byte[]>(batch)};
+        run(
+            "RingBuffer prepare/commit 4096", total, total / batch,
+            [&](std::size_t left) {
+                return ring.commit_write(copy_in(ring.prepare_write(std::min(left, batch)), src.get()));
+            },
+            [&](std::size_t left) {
+                return ring.commit_read(copy_out(ring.prepare_read(std::min(left, batch)), dst.get()));
+            });
+        bench::do_not_optimize(dst[0]);
+    }
+
+    return 0;
+}
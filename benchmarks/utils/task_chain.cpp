@@ -0,0 +1,96 @@
+/*!
+  \file
+  \brief Synchronously completing task chain benchmark.
+
+  \details
+  Measures awaits of tasks that finish without suspending, the shape of
+  `Socket::send_bytes()` looping over a `socket_send()` that completes
+  inline: once as a loop of awaits in one coroutine and once as a chain of
+  tasks each awaiting the next. Besides throughput, every case reports the
+  native stack used by its deepest await.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <sfap/utils/task.hpp>
+
+#include "common.hpp"
+
+namespace {
+
+constexpr std::size_t chunk{64};
+
+std::uintptr_t stack_low{};
+
+void probe_stack() noexcept {
+    char here{};
+    bench::do_not_optimize(here);
+    stack_low = std::min(stack_low, reinterpret_cast<std::uintptr_t>(&here));
+}
+
+/// \brief Stand-in for a send that always completes inline.
+sfap::task<std::size_t> send_chunk(std::size_t left) noexcept {
+    probe_stack();
+    co_return std::min(left, chunk);
+}
+
+sfap::task<std::size_t> send_all(std::size_t bytes) noexcept {
+    std::size_t sent{};
+    while (sent < bytes)
+        sent += co_await send_chunk(bytes - sent);
+    co_return sent;
+}
+
+sfap::task<std::size_t> nested(std::size_t depth) noexcept {
+    if (depth == 0) {
+        probe_stack();
+        co_return 0;
+    }
+    co_return 1 + co_await nested(depth - 1);
+}
+
+/// \brief Run \p body \p rounds times with \p awaits awaits each and report rate and stack use.
+template <class Body> void run(const char* name, std::size_t awaits, std::size_t rounds, Body body) {
+    char base{};
+    bench::do_not_optimize(base);
+    stack_low = reinterpret_cast<std::uintptr_t>(&base);
+
+    std::size_t total{};
+    const auto begin{bench::clock::now()};
+    for (std::size_t r = 0; r < rounds; ++r) {
+        auto task = body();
+        sfap::task<void> driver = [](sfap::task<std::size_t>& t, std::size_t& out) -> sfap::task<void> {
+            out += co_await t;
+        }(task, total);
+        driver.start_detached();
+    }
+    const double seconds{bench::seconds_since(begin)};
+    bench::do_not_optimize(total);
+
+    bench::report(name, awaits * rounds * chunk, awaits * rounds, seconds);
+    std::printf("%-40s %10zu bytes of stack at the deepest await\n", "",
+                static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(&base) - stack_low));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t awaits{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000};
+    const std::size_t rounds{argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 500};
+
+    std::printf("%zu awaits per chain, %zu rounds\n", awaits, rounds);
+
+    run("loop of awaits (send_bytes)", awaits, rounds, [&] { return send_all(awaits * chunk); });
+    run("nested awaits", awaits, rounds, [&] { return nested(awaits); });
+
+    return 0;
+}
@@ -12,9 +12,23 @@
 
 #pragma once
 
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <functional>
 #include <optional>
 #include <string_view>
 
+#include <cstdint>
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
 #include <sfap/error.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/string.hpp>
@@ -41,7 +55,7 @@ class Address {
       The resulting object contains no IP or port.
       operator bool(), is_bindable(), is_connectable() all return false.
     */
-    Address() noexcept;
+    constexpr Address() noexcept = default;
 
     /*!
       \brief Constructs an address from an IP and port.
@@ -49,9 +63,12 @@ class Address {
       \param ip   Resolved IP address.
       \param port Port number.
 
-      The origin hostname is cleared.
+      The origin hostname is cleared. Usable in constant expressions, e.g.
+      `constexpr Address peer{"10.0.0.1"_ip, 443};`.
     */
-    explicit Address(const ipx_t& ip, port_t port) noexcept;
+    constexpr explicit Address(const ipx_t& ip, port_t port) noexcept : address_(InternalAddress{ip, port}) {
+        update_socket_address();
+    }
 
     /*!
       \brief Constructs an address by resolving a hostname, then setting a port.
@@ -89,7 +106,8 @@ class Address {
     /*!
       \brief Resolves a hostname and stores the resulting IP.
       \param hostname Hostname to resolve.
-      \return sfap::no_error() on success, error_code on failure.
+      \return sfap::no_error() on success, error_code on failure;
+              `errc::NOT_ENOUGH_MEMORY` if the hostname could not be interned.
 
       On success:
         - IP is updated or created,
@@ -113,31 +131,54 @@ class Address {
     struct InternalAddress {
         ipx_t ip_;
         port_t port_;
+
+        friend constexpr bool operator==(const InternalAddress&, const InternalAddress&) noexcept = default;
+        friend constexpr std::strong_ordering operator<=>(const InternalAddress&,
+                                                          const InternalAddress&) noexcept = default;
     };
 
     /*!
       \brief Returns the stored address, if present.
       \return Optional InternalAddress.
     */
-    const std::optional<InternalAddress>& get_address() const noexcept;
+    constexpr const std::optional<InternalAddress>& get_address() const noexcept {
+        return address_;
+    }
 
     /*!
       \brief Returns the original hostname, if preserved.
       \return Optional string_view of the hostname.
+
+      Hostnames are interned in InternPool::global(), so the view stays valid
+      after the address is destroyed and equal hostnames share storage.
     */
-    std::optional<std::string_view> get_origin() const noexcept;
+    constexpr std::optional<std::string_view> get_origin() const noexcept {
+        return origin_;
+    }
+
+    /*!
+      \brief Checks whether both addresses were resolved from the same hostname.
+      \return true if both have an origin and it is the same interned string.
+
+      Compares interned pointers only, without touching the characters.
+    */
+    bool same_origin(const Address& other) const noexcept;
 
     /*!
       \brief Checks whether the object contains an IP address.
       \return true if an address is stored, false otherwise.
     */
-    explicit operator bool() const noexcept;
+    constexpr explicit operator bool() const noexcept {
+        return address_.has_value();
+    }
 
     /*!
       \brief Checks if the address can be used for binding.
       \return true if IP exists (port may be 0).
     */
-    bool is_bindable() const noexcept;
+    constexpr bool is_bindable() const noexcept {
+        return address_.has_value();
+    }
 
     /*!
       \brief Checks if the address can be used for connecting.
@@ -146,7 +187,9 @@ class Address {
         - the IP is not an "any" address,
         - the port is non-zero.
     */
-    bool is_connectable() const noexcept;
+    constexpr bool is_connectable() const noexcept {
+        return address_.has_value() && !ipx_t::is_any(address_->ip_) && address_->port_ != 0;
+    }
 
     /*!
       \brief Clears the stored address and origin.
@@ -154,9 +197,97 @@ class Address {
     */
     void clear() noexcept;
 
+    /*!
+      \brief Returns the address as a ready-made `sockaddr_in`/`sockaddr_in6`.
+      \return Pointer valid while this object is alive and unmodified, `nullptr` if empty.
+
+      Built once whenever the IP or port changes, so connect paths can hand
+      it to the kernel without per-call conversion.
+    */
+    const ::sockaddr* socket_address() const noexcept {
+        if (!address_)
+            return nullptr;
+        return address_->ip_.is_4() ? reinterpret_cast<const ::sockaddr*>(&socket_address_.v4)
+                                    : reinterpret_cast<const ::sockaddr*>(&socket_address_.v6);
+    }
+
+    /// \return Size of the structure behind socket_address(), `0` if empty.
+    constexpr socklen_t socket_address_size() const noexcept {
+        if (!address_)
+            return 0;
+        return address_->ip_.is_4() ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+    }
+
+    /*!
+      \brief Hash of IP, port and origin, consistent with operator==.
+      \return Hash value; all empty addresses hash alike.
+    */
+    std::uint64_t hash() const noexcept {
+        if (!address_)
+            return 0;
+        const auto origin{reinterpret_cast<std::uintptr_t>(origin_ ? origin_->data() : nullptr)};
+        return detail::wymix(address_->ip_.hash() ^ address_->port_, origin ^ detail::wyseed1);
+    }
+
+    /*!
+      \brief Same IP, port and origin hostname.
+      \details Origins are interned, so they compare by pointer. An address
+               resolved from a hostname differs from the bare IP address.
+    */
+    friend constexpr bool operator==(const Address& a, const Address& b) noexcept {
+        return a.address_ == b.address_ && a.origin_.has_value() == b.origin_.has_value() &&
+               (!a.origin_ || a.origin_->data() == b.origin_->data());
+    }
+
+    /// \brief Orders by IP, then port, then origin text; empty addresses first.
+    friend constexpr std::strong_ordering operator<=>(const Address& a, const Address& b) noexcept {
+        if (const auto order = a.address_ <=> b.address_; order != 0)
+            return order;
+        return a.origin_ <=> b.origin_;
+    }
+
   private:
+    /// \brief Rebuild `socket_address_` from `address_`.
+    constexpr void update_socket_address() noexcept {
+        if (!address_)
+            return;
+
+        const port_t port{address_->port_};
+        const port_t network_port{std::endian::native == std::endian::little ? std::byteswap(port) : port};
+
+        if (address_->ip_.is_4()) {
+            sockaddr_in v4{};
+            v4.sin_family = AF_INET;
+            v4.sin_port = network_port;
+            v4.sin_addr.s_addr = std::bit_cast<std::uint32_t>(address_->ip_.get_4());
+            socket_address_.v4 = v4;
+        } else {
+            sockaddr_in6 v6{};
+            v6.sin6_family = AF_INET6;
+            v6.sin6_port = network_port;
+            const ip6_t& bytes{address_->ip_.get_6()};
+            for (std::size_t i = 0; i < bytes.size(); ++i)
+                v6.sin6_addr.s6_addr[i] = bytes[i];
+            socket_address_.v6 = v6;
+        }
+    }
+
+    /// \brief Kernel form of `address_`; which member is live follows the IP family.
+    union SocketAddress {
+        sockaddr_in v4;
+        sockaddr_in6 v6;
+    };
+
     std::optional<InternalAddress> address_;
-    std::optional<String> origin_;
+    std::optional<std::string_view> origin_;
+    SocketAddress socket_address_{.v4{}};
 };
 
-} // namespace sfap::net
\ No newline at end of file
+} // namespace sfap::net
+
+/// \brief Hash for unordered containers keyed by address.
+template <> struct std::hash<sfap::net::Address> {
+    std::size_t operator()(const sfap::net::Address& address) const noexcept {
+        return static_cast<std::size_t>(address.hash());
+    }
+};
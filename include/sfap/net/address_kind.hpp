@@ -41,15 +41,14 @@ enum class AddressKind : std::uint8_t {
 
   \return
     - On success: \c sfap::expected containing one of \c AddressType::{EMPTY, IP4, IP6, HOSTNAME, UNKNOWN}.
-    - On failure: \c sfap::unexpected with a \c sfap::error_code describing the OS error returned by the underlying
-  parser (e.g., \c inet_pton).
+    - On failure: \c sfap::unexpected with a \c sfap::error_code. The current parser never fails; the result type
+    is kept for platforms that may need an OS parser.
 
   \remarks
-    - IPv4/IPv6 detection uses textual forms. For IPv6, zone IDs or bracketed forms may be rejected depending on
-    implementation.
+    - IPv4/IPv6 detection uses parse_ip(), which accepts the same textual forms as \c inet_pton. For IPv6, zone IDs
+    and bracketed forms are rejected.
     - Hostname validation follows DNS label rules (labels 1–63 chars, A–Z/a–z/0–9 and \c '-', no leading/trailing dash).
     FQDN length limits apply.
-    - Error category: \c sfap::network_category.
 
     \note Function is \c noexcept; errors are reported via \c sfap::error_code.
 */
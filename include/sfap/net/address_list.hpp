@@ -0,0 +1,81 @@
+/*!
+  \file
+  \brief Resolved address list interface.
+
+  \details
+  Small vector of IP addresses returned by resolve_all().
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <cstddef>
+
+#include <sfap/net/types.hpp>
+
+namespace sfap::net {
+
+/*!
+  \brief Growable list of addresses with inline storage for typical replica sets.
+
+  \details Up to `inline_capacity` addresses live inside the object; longer
+           lists move to the heap, doubling on each growth. Move-only.
+
+  \par Exceptions
+  All functions are `noexcept`. Allocation failure is reported by push_back().
+*/
+class AddressList {
+
+  public:
+    /// \brief Addresses stored without allocating.
+    static constexpr std::size_t inline_capacity{16};
+
+    AddressList() noexcept = default;
+    ~AddressList() noexcept;
+
+    AddressList(AddressList&& other) noexcept;
+    AddressList& operator=(AddressList&& other) noexcept;
+
+    AddressList(const AddressList&) = delete;
+    AddressList& operator=(const AddressList&) = delete;
+
+    /*!
+      \brief Append \p ip.
+      \return `false` if more storage was needed and could not be allocated.
+    */
+    bool push_back(const ipx_t& ip) noexcept;
+
+    /// \return `true` if \p ip is in the list.
+    bool contains(const ipx_t& ip) const noexcept;
+
+    /// \brief Remove all addresses, keeping the storage.
+    void clear() noexcept;
+
+    std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
+    bool empty() const noexcept;
+
+    const ipx_t* data() const noexcept;
+    const ipx_t& operator[](std::size_t i) const noexcept;
+
+    const ipx_t* begin() const noexcept;
+    const ipx_t* end() const noexcept;
+
+    operator std::span<const ipx_t>() const noexcept;
+
+  private:
+    ipx_t* storage() noexcept;
+
+    ipx_t* heap_{};                         ///< Heap storage once the list outgrew `inline_`.
+    std::size_t size_{};                    ///< Stored addresses.
+    std::size_t capacity_{inline_capacity}; ///< Capacity of the active storage.
+    std::array<ipx_t, inline_capacity> inline_;
+};
+
+} // namespace sfap::net
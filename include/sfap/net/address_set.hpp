@@ -0,0 +1,152 @@
+/*!
+  \file
+  \brief Client-side load balancing interface.
+
+  \details
+  Picks one address out of a replica set for each new connection.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/net/address.hpp>
+#include <sfap/net/types.hpp>
+
+namespace sfap::net {
+
+/// \brief How AddressSet::acquire() picks a replica.
+enum class BalancePolicy : std::uint8_t {
+    ROUND_ROBIN,          ///< Each replica in turn.
+    POWER_OF_TWO_CHOICES, ///< The less loaded of two random replicas.
+    LEAST_OUTSTANDING     ///< The least loaded replica; ties go round-robin.
+};
+
+/*!
+  \brief Replica set that spreads connections over all its addresses.
+
+  \details Load is the number of live leases per address. A Lease is taken
+           for each connection and released when the connection ends, so the
+           load-aware policies see work that is still in flight. Round robin
+           counts leases too but does not look at them.
+
+           `POWER_OF_TWO_CHOICES` keeps the set within a small constant of
+           perfectly balanced for a fraction of the cost of a full scan, and
+           `LEAST_OUTSTANDING` scans every address on each pick; prefer it
+           for small sets with uneven request cost.
+
+           The set owns its addresses and never moves; leases point into it
+           and must not outlive it.
+
+  \par Thread-safety
+  acquire() and leases may be used from any number of threads concurrently.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class AddressSet {
+
+    struct Slot;
+
+  public:
+    /// \brief Claim on one address, counted as outstanding until released.
+    class Lease {
+      public:
+        Lease() noexcept = default;
+        ~Lease() noexcept;
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /// \return `true` unless empty or released.
+        explicit operator bool() const noexcept;
+
+        /// \return Leased address. Only valid for a non-empty lease.
+        const Address& address() const noexcept;
+
+        /// \return Position of the leased address in its set.
+        std::size_t index() const noexcept;
+
+        /// \brief Give the claim back early. The lease becomes empty.
+        void release() noexcept;
+
+      private:
+        friend class AddressSet;
+
+        Lease(Slot* slot, std::size_t index) noexcept;
+
+        Slot* slot_{};
+        std::size_t index_{};
+    };
+
+    /// \brief Constructs an empty set.
+    AddressSet() noexcept = default;
+
+    /*!
+      \brief Set of \p ips, all on \p port.
+      \note Allocation is nothrow. On failure the set is empty.
+    */
+    AddressSet(std::span<const ipx_t> ips, port_t port, BalancePolicy policy = BalancePolicy::ROUND_ROBIN) noexcept;
+
+    /*!
+      \brief Set of \p addresses. Empty addresses are skipped.
+      \note Allocation is nothrow. On failure the set is empty.
+    */
+    explicit AddressSet(std::span<const Address> addresses,
+                        BalancePolicy policy = BalancePolicy::ROUND_ROBIN) noexcept;
+
+    AddressSet(AddressSet&&) = delete;
+    AddressSet(const AddressSet&) = delete;
+
+    AddressSet& operator=(AddressSet&&) = delete;
+    AddressSet& operator=(const AddressSet&) = delete;
+
+    /// \return `true` if the set has at least one address.
+    explicit operator bool() const noexcept;
+
+    /// \return Number of addresses.
+    std::size_t size() const noexcept;
+
+    /// \return Policy used by acquire().
+    BalancePolicy policy() const noexcept;
+
+    /// \return Address \p i, in construction order.
+    const Address& operator[](std::size_t i) const noexcept;
+
+    /// \return Live leases on address \p i.
+    std::uint32_t outstanding(std::size_t i) const noexcept;
+
+    /*!
+      \brief Pick an address according to the policy and lease it.
+      \return Lease, empty if the set is empty.
+    */
+    Lease acquire() noexcept;
+
+  private:
+    /// \brief One replica on its own cache line, so counters do not false-share.
+    struct alignas(64) Slot {
+        Address address;
+        std::atomic<std::uint32_t> outstanding{};
+    };
+
+    std::size_t choose() noexcept;
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t size_{};
+    BalancePolicy policy_{BalancePolicy::ROUND_ROBIN};
+    std::atomic<std::size_t> cursor_{}; ///< Next round-robin position, also rotates ties.
+};
+
+} // namespace sfap::net
@@ -0,0 +1,182 @@
+/*!
+  \file
+  \brief Outbound connection pool interface.
+
+  \details
+  Keeps established connections per peer so requests skip the TCP
+  handshake, with per-peer limits, idle eviction and pre-warming driven by
+  proactor timers.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <chrono>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/socket_options.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+namespace sfap::net {
+
+/// \brief Tuning of a ConnectionPool.
+struct ConnectionPoolOptions {
+    using duration = Proactor::duration;
+
+    std::size_t max_per_host{8};                     ///< Connections per peer: leased, idle and connecting.
+    std::size_t max_idle_per_host{8};                ///< Idle connections kept per peer; extra ones are closed.
+    duration idle_timeout{std::chrono::seconds{30}}; ///< Idle connections older than this are closed.
+    duration connect_timeout{duration::max()};       ///< Passed to Proactor::connect().
+    duration maintenance_interval{std::chrono::seconds{1}}; ///< Eviction and pre-warm period; `0` disables both.
+    std::size_t prewarm_idle{0};                     ///< Idle connections kept ready for hot peers; `0` disables.
+    std::size_t hot_acquires{16};                    ///< Acquires per maintenance interval that make a peer hot.
+    SocketOptions socket;                            ///< Applied to every new connection.
+};
+
+/*!
+  \brief Pool of outbound TCP connections keyed by peer Address.
+
+  \details acquire() hands out the most recently used idle connection to the
+           peer, after checking with Proactor::socket_alive() that the peer
+           has not closed it meanwhile, and connects a new one only when none
+           is left. When a peer already has `max_per_host` connections,
+           acquire() waits for one to be released; waiters are served in
+           order.
+
+           A Lease returns its connection to the pool when it is released or
+           destroyed. Call Lease::discard() instead after an I/O error or a
+           half-finished exchange, so the connection is closed rather than
+           reused by the next request.
+
+           Every `maintenance_interval` a timer on the proactor closes idle
+           connections past `idle_timeout` or found dead, and opens
+           connections in the background until every hot peer has
+           `prewarm_idle` of them idle. prewarm() does the same on demand.
+           The first acquire() or prewarm() starts the timer.
+
+           Addresses compare with their origin hostname, so a resolved
+           address and its bare IP get separate connections.
+
+  \par Thread-safety
+  Not thread-safe. The pool, its leases and its tasks must be used on the
+  proactor's loop thread only.
+
+  \par Lifetime
+  The pool may be destroyed while leases, acquires and timers are still
+  pending: leases then close their connection, pending acquires fail with
+  `ECANCELED` and the timer stops at its next tick. The proactor must outlive
+  all of them.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class ConnectionPool {
+
+    struct State;
+
+  public:
+    using clock = Proactor::clock;
+    using duration = Proactor::duration;
+
+    /// \brief Counter snapshot.
+    struct Stats {
+        std::uint64_t reused;    ///< Acquires served by an idle connection.
+        std::uint64_t connected; ///< Connections opened by acquire().
+        std::uint64_t prewarmed; ///< Connections opened ahead of demand.
+        std::uint64_t waited;    ///< Acquires that had to wait for the per-host limit.
+        std::uint64_t dead;      ///< Idle connections found closed by the peer.
+        std::uint64_t expired;   ///< Idle connections closed after `idle_timeout`.
+        std::size_t idle;        ///< Connections idle right now.
+        std::size_t leased;      ///< Connections leased right now.
+    };
+
+    /// \brief Connection on loan from the pool.
+    class Lease {
+      public:
+        Lease() noexcept = default;
+        ~Lease() noexcept;
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /// \return `true` unless empty, released or discarded.
+        explicit operator bool() const noexcept;
+
+        /// \return Leased connection. Only valid for a non-empty lease.
+        Socket& socket() noexcept;
+
+        /// \return Peer of the connection. Only valid for a non-empty lease.
+        const Address& address() const noexcept;
+
+        /// \brief Return the connection for reuse. The lease becomes empty.
+        void release() noexcept;
+
+        /// \brief Close the connection instead of reusing it. The lease becomes empty.
+        void discard() noexcept;
+
+      private:
+        friend class ConnectionPool;
+
+        Lease(State* state, const Address& address, Socket&& socket) noexcept;
+
+        void give_back(bool reuse) noexcept;
+
+        State* state_{};
+        Address address_;
+        Socket socket_;
+    };
+
+    explicit ConnectionPool(Proactor& proactor, const ConnectionPoolOptions& options = {}) noexcept;
+    ~ConnectionPool() noexcept;
+
+    ConnectionPool(ConnectionPool&&) = delete;
+    ConnectionPool(const ConnectionPool&) = delete;
+
+    ConnectionPool& operator=(ConnectionPool&&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    /// \return `false` if the pool state could not be allocated; every call then fails.
+    explicit operator bool() const noexcept;
+
+    /*!
+      \brief Lease a connection to \p address.
+      \return Lease, the connect error, `errc::NOT_ENOUGH_MEMORY`, or
+              `ECANCELED` if the pool was destroyed while waiting.
+    */
+    sfap::task<sfap::result<Lease>> acquire(const Address& address) noexcept;
+
+    /*!
+      \brief Open connections to \p address until \p count of them are idle.
+      \details Stays within `max_per_host` and `max_idle_per_host`. Attempts
+               run one after another; the first failure stops the task.
+      \return Connections opened.
+    */
+    sfap::task<std::size_t> prewarm(const Address& address, std::size_t count) noexcept;
+
+    /// \brief Close idle connections past `idle_timeout` or found dead, as the timer does.
+    void evict_idle() noexcept;
+
+    /// \return Idle connections to \p address.
+    std::size_t idle(const Address& address) const noexcept;
+
+    /// \return Current counters.
+    Stats stats() const noexcept;
+
+  private:
+    State* state_;
+};
+
+} // namespace sfap::net
@@ -0,0 +1,262 @@
+/*!
+  \file
+  \brief DNS stub resolver building blocks.
+
+  \details
+  Message codec for A/AAAA queries, `/etc/resolv.conf` and `/etc/hosts`
+  parsing, and the configuration used by Proactor::resolve() to query name
+  servers through the proactor instead of blocking in `getaddrinfo`.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/types.hpp>
+
+namespace sfap::net::dns {
+
+/// \brief Record types the resolver asks for.
+enum class Type : std::uint16_t {
+    A = 1,    ///< IPv4 address.
+    AAAA = 28 ///< IPv6 address.
+};
+
+/*!
+  \brief DNS failures, in the `dns` error category.
+  \details Values 1-5 are the RFC 1035 response codes.
+*/
+enum class errc : int {
+    OK,
+    FORMAT_ERROR,    ///< Server could not parse the query.
+    SERVER_FAILURE,  ///< Server could not answer.
+    NAME_ERROR,      ///< Name does not exist (NXDOMAIN).
+    NOT_IMPLEMENTED, ///< Server does not support the query.
+    REFUSED,         ///< Server refused to answer.
+    NO_DATA = 16,    ///< Name exists but has no address of the requested family.
+    MALFORMED,       ///< Message is truncated or inconsistent.
+    TIMEOUT,         ///< No server answered in time.
+    NO_SERVERS       ///< No usable name server is configured.
+};
+
+/// \brief Return DNS error.
+sfap::unexpected<sfap::error_code> error(errc code) noexcept;
+
+/// \brief Largest message sent or accepted over UDP (RFC 1035 without EDNS).
+inline constexpr std::size_t max_udp_message{512};
+
+/// \brief Longest domain name, without the trailing dot.
+inline constexpr std::size_t max_name_size{253};
+
+/// \brief Domain name stored inline, without the trailing dot.
+struct Name {
+    std::size_t size{}; ///< Number of valid characters in `chars`.
+    std::array<char, max_name_size> chars;
+
+    /*!
+      \brief Replace the name with \p parts, concatenated.
+      \return `false`, leaving the name unchanged, if the result is longer than max_name_size.
+    */
+    bool assign(std::initializer_list<std::string_view> parts) noexcept;
+
+    std::string_view view() const noexcept {
+        return {chars.data(), size};
+    }
+};
+
+/*!
+  \brief Encode a recursive query for \p name.
+
+  \param out  Destination; 12 bytes of header plus the encoded name and 4 bytes.
+  \param id   Query ID echoed by the server.
+  \param name Domain name, with or without the trailing dot.
+  \param type Record type asked for.
+
+  \return Bytes written, or `sfap::errc::INVALID_ARGUMENT` if \p name has an empty
+          or over-long label, is longer than 253 characters, or \p out is too small.
+*/
+sfap::result<std::size_t> encode_query(std::span<std::byte> out, std::uint16_t id, std::string_view name,
+                                       Type type) noexcept;
+
+/// \brief Addresses found in a response.
+struct Response {
+    static constexpr std::size_t max_addresses{16};
+
+    std::uint16_t id{};   ///< Query ID.
+    Type type{Type::A};   ///< Question type.
+    std::uint8_t rcode{}; ///< Response code, `0` on success.
+    bool truncated{};     ///< Answer did not fit; retry over TCP.
+    std::uint32_t ttl{};  ///< Smallest TTL of the returned addresses.
+    std::size_t count{};  ///< Number of valid entries in `addresses`.
+    std::array<ipx_t, max_addresses> addresses;
+
+    /// \return Returned addresses, in answer order.
+    std::span<const ipx_t> answers() const noexcept {
+        return {addresses.data(), count};
+    }
+};
+
+/*!
+  \brief Decode a response to a query for \p name.
+
+  \details Checks that the message is a response whose single question is
+           \p name (case-insensitively) and collects every answer record of
+           the question type, which includes the addresses at the end of a
+           CNAME chain. Compression pointers are followed with loop detection.
+           Addresses past Response::max_addresses are dropped.
+
+  \return Response, or `errc::MALFORMED` if the message is not a well-formed
+          response to \p name.
+*/
+sfap::result<Response> decode_response(std::span<const std::byte> message, std::string_view name) noexcept;
+
+/*!
+  \brief Parsed `/etc/hosts`.
+  \details Names compare case-insensitively. When a name is listed several
+           times, the first address of each family wins, like glibc.
+*/
+class Hosts {
+  public:
+    Hosts() noexcept = default;
+    ~Hosts() noexcept;
+
+    Hosts(Hosts&& other) noexcept;
+    Hosts& operator=(Hosts&& other) noexcept;
+
+    Hosts(const Hosts&) = delete;
+    Hosts& operator=(const Hosts&) = delete;
+
+    /*!
+      \brief Add the entries of hosts file \p text.
+      \return `sfap::errc::NOT_ENOUGH_MEMORY` if a name could not be stored;
+              the entries before it are kept.
+    */
+    sfap::error_code parse(std::string_view text) noexcept;
+
+    /*!
+      \brief Look up \p name.
+      \return Address picked by \p mode, `std::nullopt` if none fits.
+    */
+    std::optional<ipx_t> find(std::string_view name, ResolveMode mode) const noexcept;
+
+    /// \return Number of distinct names.
+    std::size_t size() const noexcept;
+
+  private:
+    struct Entry {
+        char* name{};      ///< Lowercase name, `nullptr` while the slot is unused.
+        std::size_t size{};
+        std::optional<ipx_t> v4;
+        std::optional<ipx_t> v6;
+    };
+
+    /*!
+      \return Slot holding \p name, or the free slot where it belongs.
+      \pre The table is allocated.
+    */
+    Entry& slot(std::string_view name) const noexcept;
+
+    /// \brief Make room for one more name, keeping the table at most half full.
+    bool reserve() noexcept;
+
+    void clear() noexcept;
+
+    Entry* entries_{};   ///< Open-addressed table, keyed by lowercase name.
+    std::size_t mask_{}; ///< Table size minus one, or `0` before the first name.
+    std::size_t size_{};
+};
+
+/// \brief Resolver configuration, normally read from `/etc/resolv.conf` and `/etc/hosts`.
+struct Config {
+    using duration = std::chrono::milliseconds;
+
+    static constexpr port_t port{53};
+    static constexpr std::size_t max_nameservers{3}; ///< Like glibc's `MAXNS`.
+    static constexpr std::size_t max_search{6};      ///< Like glibc's `MAXDNSRCH`.
+
+    /// \brief Names to query for one host, in order.
+    struct Candidates {
+        std::size_t count{}; ///< Number of valid entries in `names`.
+        std::array<Name, max_search + 1> names;
+
+        const Name* begin() const noexcept {
+            return names.data();
+        }
+
+        const Name* end() const noexcept {
+            return names.data() + count;
+        }
+    };
+
+    std::size_t nameserver_count{};                   ///< Number of valid entries in `nameservers`.
+    std::array<Address, max_nameservers> nameservers; ///< Queried in order.
+    std::size_t search_count{};                       ///< Number of valid entries in `search`.
+    std::array<Name, max_search> search;              ///< Domains appended to relative names.
+    unsigned ndots{1};                                ///< Dots that make a name be tried as-is first.
+    duration timeout{5000};                           ///< Per-server wait for an answer.
+    unsigned attempts{2};                             ///< Rounds over all name servers.
+    Hosts hosts;                                      ///< Consulted before any query.
+
+    /// \return `false` if max_nameservers are configured already.
+    bool add_nameserver(const Address& server) noexcept;
+
+    /// \return `false` if max_search domains are configured already or \p domain is too long.
+    bool add_search(std::string_view domain) noexcept;
+
+    /// \return Configured name servers, in order.
+    std::span<const Address> servers() const noexcept {
+        return {nameservers.data(), nameserver_count};
+    }
+
+    /// \return Configured search domains, in order.
+    std::span<const Name> domains() const noexcept {
+        return {search.data(), search_count};
+    }
+
+    /*!
+      \brief Apply the `nameserver`, `search`, `domain` and `options` lines of \p text.
+      \details Unknown keywords and malformed lines are ignored, as the C library does.
+               Without any name server, `127.0.0.1` is used.
+    */
+    void parse_resolv_conf(std::string_view text) noexcept;
+
+    /*!
+      \brief Names to query for \p name, in order.
+      \details A trailing dot makes \p name absolute. Otherwise names with at
+               least `ndots` dots are tried as-is before the search domains and
+               the others after them. Names longer than max_name_size are skipped.
+    */
+    Candidates candidates(std::string_view name) const noexcept;
+
+    /*!
+      \brief Read both files.
+      \details Missing files are treated as empty.
+      \return Configuration, or `sfap::errc::NOT_ENOUGH_MEMORY` if a file
+              could not be read or the hosts table could not grow.
+    */
+    static sfap::result<Config> load(const char* resolv_conf = "/etc/resolv.conf",
+                                     const char* hosts = "/etc/hosts") noexcept;
+
+    /*!
+      \return Configuration loaded once from the system files. If they could
+              not be loaded, the defaults of parse_resolv_conf() without hosts.
+    */
+    static const Config& system() noexcept;
+};
+
+} // namespace sfap::net::dns
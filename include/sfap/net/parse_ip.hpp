@@ -0,0 +1,249 @@
+/*!
+  \file
+  \brief Textual IP address parser.
+
+  \details
+  Single-pass parsers for dotted-quad IPv4 and RFC 4291 IPv6 text that
+  produce network byte order addresses without going through the system
+  resolver. Everything is `constexpr`, and the `_ip4`, `_ip6` and `_ip`
+  literals parse at compile time:
+
+  \code
+  using namespace sfap::net::literals;
+  constexpr ipx_t gateway{"10.0.0.1"_ip};
+  static_assert("::ffff:10.0.0.1"_ip6[15] == 1);
+  \endcode
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/net/types.hpp>
+
+namespace sfap::net {
+
+namespace detail {
+
+/// \brief Marks bytes that are not hexadecimal digits in `hex_value`.
+inline constexpr std::uint8_t not_hex{0xFF};
+
+/// \brief Digit value of every byte, `not_hex` for non-digits.
+inline constexpr std::array<std::uint8_t, 256> hex_value = [] {
+    std::array<std::uint8_t, 256> table{};
+    table.fill(not_hex);
+    for (int c = '0'; c <= '9'; ++c)
+        table[c] = static_cast<std::uint8_t>(c - '0');
+    for (int c = 'a'; c <= 'f'; ++c)
+        table[c] = static_cast<std::uint8_t>(c - 'a' + 10);
+    for (int c = 'A'; c <= 'F'; ++c)
+        table[c] = static_cast<std::uint8_t>(c - 'A' + 10);
+    return table;
+}();
+
+constexpr std::uint8_t decimal(char c) noexcept {
+    const std::uint8_t value{hex_value[static_cast<unsigned char>(c)]};
+    return value < 10 ? value : not_hex;
+}
+
+/*!
+  \brief Parses a dotted quad into \p out.
+  \return `true` on success.
+*/
+constexpr bool parse_quad(std::string_view text, std::uint8_t* out) noexcept {
+    // Shortest form is "0.0.0.0", longest "255.255.255.255".
+    if (text.size() < 7 || text.size() > 15)
+        return false;
+
+    std::size_t i{};
+    for (int octet = 0; octet < 4; ++octet) {
+        if (octet != 0) {
+            if (i == text.size() || text[i] != '.')
+                return false;
+            ++i;
+        }
+
+        if (i == text.size())
+            return false;
+        unsigned value{decimal(text[i])};
+        if (value == not_hex)
+            return false;
+        ++i;
+
+        // A leading zero must stand alone.
+        if (value != 0) {
+            for (int digits = 1; digits < 3 && i < text.size(); ++digits, ++i) {
+                const std::uint8_t digit{decimal(text[i])};
+                if (digit == not_hex)
+                    break;
+                value = value * 10 + digit;
+            }
+            if (value > 255)
+                return false;
+        }
+        out[octet] = static_cast<std::uint8_t>(value);
+    }
+    return i == text.size();
+}
+
+/// \brief Deliberately not `constexpr`: reaching it during constant evaluation is a compile error.
+inline void invalid_ip_literal() noexcept {}
+
+} // namespace detail
+
+/*!
+  \brief Parses a dotted-quad IPv4 address.
+  \param text Input, not necessarily null-terminated.
+  \return Address bytes, or `std::nullopt` if \p text is not a valid IPv4 literal.
+
+  \remarks Accepts exactly what POSIX `inet_pton(AF_INET)` accepts: four
+           decimal octets 0-255 separated by dots, without leading zeros.
+*/
+constexpr std::optional<ip4_t> parse_ip4(std::string_view text) noexcept {
+    ip4_t ip{};
+    if (!detail::parse_quad(text, ip.data()))
+        return std::nullopt;
+    return ip;
+}
+
+/*!
+  \brief Parses an IPv6 address.
+  \param text Input, not necessarily null-terminated.
+  \return Address bytes, or `std::nullopt` if \p text is not a valid IPv6 literal.
+
+  \remarks Accepts exactly what `inet_pton(AF_INET6)` accepts: up to eight
+           groups of 1-4 hex digits, one optional `::` standing for at least
+           one zero group, and an optional dotted-quad tail in the last 32 bits.
+           Brackets and zone IDs are rejected.
+*/
+constexpr std::optional<ip6_t> parse_ip6(std::string_view text) noexcept {
+    // "ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255" is the longest valid form.
+    if (text.size() < 2 || text.size() > 45)
+        return std::nullopt;
+
+    ip6_t ip{};
+    std::size_t out{};              // next byte of `ip` to write
+    std::optional<std::size_t> gap; // byte offset of the "::"
+    std::size_t i{};
+
+    if (text[0] == ':') {
+        if (text[1] != ':')
+            return std::nullopt;
+        gap = 0;
+        i = 2;
+    }
+
+    while (i < text.size()) {
+        const std::size_t group_start{i};
+        unsigned value{};
+        std::size_t digits{};
+        for (; i < text.size() && digits < 5; ++i, ++digits) {
+            const std::uint8_t digit{detail::hex_value[static_cast<unsigned char>(text[i])]};
+            if (digit == detail::not_hex)
+                break;
+            value = (value << 4) | digit;
+        }
+        if (digits > 4)
+            return std::nullopt;
+
+        if (i < text.size() && text[i] == '.') {
+            // Dotted-quad tail, only in the last 32 bits.
+            if (out + 4 > ip.size() || !detail::parse_quad(text.substr(group_start), ip.data() + out))
+                return std::nullopt;
+            out += 4;
+            break;
+        }
+
+        if (digits == 0) {
+            // Right after a separator: a second ':' opens the one allowed gap.
+            if (i < text.size() && text[i] == ':' && !gap) {
+                gap = out;
+                ++i;
+                continue;
+            }
+            return std::nullopt;
+        }
+
+        if (out + 2 > ip.size())
+            return std::nullopt;
+        ip[out++] = static_cast<std::uint8_t>(value >> 8);
+        ip[out++] = static_cast<std::uint8_t>(value);
+
+        if (i == text.size())
+            break;
+        if (text[i] != ':')
+            return std::nullopt;
+        ++i;
+        if (i == text.size())
+            return std::nullopt; // trailing single ':'
+    }
+
+    if (gap) {
+        // "::" must stand for at least one zero group.
+        if (out == ip.size())
+            return std::nullopt;
+        std::copy_backward(ip.begin() + *gap, ip.begin() + out, ip.end());
+        std::fill(ip.begin() + *gap, ip.end() - (out - *gap), std::uint8_t{0});
+    } else if (out != ip.size()) {
+        return std::nullopt;
+    }
+
+    return ip;
+}
+
+/*!
+  \brief Parses an IPv4 or IPv6 address, picking the family from the text.
+  \param text Input, not necessarily null-terminated.
+  \return Parsed address, or `std::nullopt` if \p text is not an IP literal.
+*/
+constexpr std::optional<ipx_t> parse_ip(std::string_view text) noexcept {
+    // An IPv6 literal has a ':' within its first five characters, an IPv4 one never does.
+    if (text.substr(0, 5).find(':') != std::string_view::npos) {
+        if (auto ip6 = parse_ip6(text))
+            return ipx_t{*ip6};
+        return std::nullopt;
+    }
+    if (auto ip4 = parse_ip4(text))
+        return ipx_t{*ip4};
+    return std::nullopt;
+}
+
+namespace literals {
+
+/// \brief IPv4 literal, e.g. `"192.0.2.1"_ip4`. Invalid text does not compile.
+consteval ip4_t operator""_ip4(const char* text, std::size_t size) noexcept {
+    const auto ip = parse_ip4({text, size});
+    if (!ip)
+        detail::invalid_ip_literal();
+    return *ip;
+}
+
+/// \brief IPv6 literal, e.g. `"2001:db8::1"_ip6`. Invalid text does not compile.
+consteval ip6_t operator""_ip6(const char* text, std::size_t size) noexcept {
+    const auto ip = parse_ip6({text, size});
+    if (!ip)
+        detail::invalid_ip_literal();
+    return *ip;
+}
+
+/// \brief IPv4 or IPv6 literal, e.g. `"::1"_ip`. Invalid text does not compile.
+consteval ipx_t operator""_ip(const char* text, std::size_t size) noexcept {
+    const auto ip = parse_ip({text, size});
+    if (!ip)
+        detail::invalid_ip_literal();
+    return *ip;
+}
+
+} // namespace literals
+
+} // namespace sfap::net
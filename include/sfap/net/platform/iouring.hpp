@@ -6,8 +6,11 @@
 
 #include <atomic>
 #include <coroutine>
+#include <mutex>
 #include <span>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -18,6 +21,7 @@
 #include <sfap/net/address.hpp>
 #include <sfap/net/proactor.hpp>
 #include <sfap/net/socket.hpp>
+#include <sfap/net/socket_options.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/task.hpp>
 
@@ -38,14 +42,40 @@ class IOUringProactor final : public Proactor {
     void run() noexcept override;
     void stop() noexcept override;
 
-    task<sfap::result<Socket>> connect(const Address& address, duration timeout = duration::max()) noexcept override;
+    /*!
+      \brief Queue \p h for resumption on the loop thread.
+      \details From the loop thread itself the handle goes straight to the
+               ready queue. From any other thread the loop is also woken
+               through an eventfd read kept armed in the ring.
+    */
+    void post(std::coroutine_handle<> h) noexcept override;
+
+    task<sfap::result<Socket>> connect(const Address& address, duration timeout = duration::max(),
+                                      const SocketOptions& options = {}) noexcept override;
     void close(socket_t handle) noexcept override;
 
+    sfap::result<Socket> open_stream(const Address& peer, const SocketOptions& options = {}) noexcept override;
+    /// \brief Connect with `IORING_OP_CONNECT`, with a linked timeout unless \p timeout is `duration::max()`.
+    task<error_code> socket_connect(socket_t handle, const Address& address,
+                                    duration timeout = duration::max()) noexcept override;
+    /// \brief Submit an `IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL` cancellation (Linux 5.19+).
+    void cancel(socket_t handle) noexcept override;
+    /// \brief Peek one byte with `MSG_DONTWAIT`; only `EAGAIN` means the connection is idle and open.
+    bool socket_alive(socket_t handle) noexcept override;
+
     task<error_code> sleep_for(duration d) noexcept override;
 
     task<result<std::size_t>> socket_send(socket_t handle, std::span<const std::byte> data) noexcept override;
+    /// \brief Send all \p data segments with one `sendmsg`. Returns bytes sent, possibly fewer than the total.
+    task<result<std::size_t>> socket_sendv(socket_t handle,
+                                           std::span<const std::span<const std::byte>> data) noexcept override;
     task<result<std::size_t>> socket_recv(socket_t handle, std::span<std::byte> data) noexcept override;
 
+    sfap::result<Socket> connect_datagram(const Address& peer) noexcept override;
+    /// \brief Receive with an `IORING_OP_LINK_TIMEOUT` linked to the read.
+    task<result<std::size_t>> socket_recv_for(socket_t handle, std::span<std::byte> data,
+                                              duration timeout) noexcept override;
+
   private:
     error_code last_error_{no_error()};
 
@@ -83,6 +113,13 @@ class IOUringProactor final : public Proactor {
 
     io_uring ring_{};
     std::atomic_bool running_{false};
+    std::atomic<std::thread::id> loop_thread_{};
+
+    int wake_fd_{-1};                            ///< eventfd used by `post()` from foreign threads.
+    std::uint64_t wake_value_{};                 ///< Target of the armed eventfd read.
+    bool wake_armed_{};                          ///< An eventfd read is queued; loop thread only.
+    std::mutex ready_mutex_;                     ///< Guards `ready_`.
+    std::vector<std::coroutine_handle<>> ready_; ///< Coroutines posted for resumption.
 
     socket_t next_handle_id_{1};
     std::unordered_map<socket_t, SocketState> sockets_;
@@ -91,6 +128,19 @@ class IOUringProactor final : public Proactor {
     void free_opdata(OperationData* opdata) noexcept;
 
     void handle_cqe(io_uring_cqe* cqe) noexcept;
+
+    /*!
+      \brief Link a timeout of \p timeout, stored in \p ts, to the already prepared \p sqe.
+      \details The operation then completes with `-ECANCELED` when the time runs out.
+      \return `false` if the ring has no free entry; \p sqe is turned into a no-op.
+    */
+    bool link_timeout(io_uring_sqe* sqe, __kernel_timespec& ts, duration timeout) noexcept;
+
+    void wake() noexcept;
+
+    /// \brief Queue the eventfd read behind wake(); sets `wake_armed_` to whether it was queued.
+    void arm_wakeup() noexcept;
+    void run_ready() noexcept;
 };
 
 } // namespace sfap::net
@@ -0,0 +1,152 @@
+/*!
+  \file
+  \brief CIDR prefix table interface.
+
+  \details
+  Longest-prefix match over IPv4 and IPv6 prefixes, e.g. for allow/deny
+  lists checked on every accepted connection.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/memory.hpp>
+
+namespace sfap::net {
+
+/*!
+  \brief Immutable longest-prefix match table.
+
+  \details A multibit trie with 8-bit strides and leaf pushing: every node is
+           256 `uint32_t` entries, each either empty, a value or a child node.
+           Prefixes are expanded into all entries they cover, so a lookup is
+           one indexed load per address byte and stops at the first non-child
+           entry - at most 4 loads for IPv4 and 16 for IPv6, with no
+           backtracking. All nodes live in one contiguous allocation.
+
+           Tables are built with PrefixTable::Builder and never change
+           afterwards. To update a live table, build a new one and publish it,
+           e.g. through `std::atomic<std::shared_ptr<const PrefixTable>>`.
+
+  \par Thread-safety
+  All const member functions may be called concurrently without locking.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class PrefixTable {
+
+  public:
+    /// \brief Largest value a prefix can map to.
+    static constexpr std::uint32_t max_value{0x7FFFFFFE};
+
+    /*!
+      \brief Collects prefixes and compiles them into a PrefixTable.
+
+      \details Adding the same prefix twice keeps the last value. Bits past the
+               prefix length are ignored, so `10.1.2.3/8` equals `10.0.0.0/8`.
+    */
+    class Builder {
+      public:
+        /*!
+          \brief Add \p address / \p length mapping to \p value.
+          \return `false` if \p length exceeds the address width, \p value exceeds max_value
+                  or the prefix could not be stored.
+        */
+        bool add(const ipx_t& address, std::uint8_t length, std::uint32_t value) noexcept;
+
+        /*!
+          \brief Add a prefix in CIDR notation, e.g. `192.0.2.0/24` or `2001:db8::/32`.
+          \details A bare address is a host route (`/32` or `/128`).
+          \return `false` if \p cidr is malformed, \p value exceeds max_value or the prefix
+                  could not be stored.
+        */
+        bool add(std::string_view cidr, std::uint32_t value) noexcept;
+
+        /*!
+          \brief Add one prefix per line, each optionally followed by its own value.
+
+          \details Lines look like `10.0.0.0/8` or `2001:db8::/32 7`. Spaces and
+                   tabs separate fields, `#` starts a comment and blank lines are
+                   skipped. Lines without a value use \p value.
+
+          \return Number of prefixes added, `errc::INVALID_ARGUMENT` on the first
+                  malformed line or `errc::NOT_ENOUGH_MEMORY`. Lines before the
+                  failing one stay added.
+        */
+        sfap::result<std::size_t> add_text(std::string_view text, std::uint32_t value = 0) noexcept;
+
+        /// \return Number of prefixes added so far.
+        std::size_t size() const noexcept;
+
+        /*!
+          \brief Compile the collected prefixes into a heap-backed table.
+          \details Nodes are counted first and written straight into the
+                   table's storage, so peak memory is the table plus a
+                   working copy of the prefixes.
+          \return Table, or `errc::NOT_ENOUGH_MEMORY`.
+        */
+        sfap::result<PrefixTable> build() const noexcept;
+
+        /*!
+          \brief Compile the collected prefixes into page-backed storage.
+          \details Large tables benefit from `MemoryOptions::Pages::TRANSPARENT_HUGE`,
+                   which keeps lookups from missing the TLB.
+          \return Table, or `errc::NOT_ENOUGH_MEMORY`.
+        */
+        sfap::result<PrefixTable> build(const MemoryOptions& options) const noexcept;
+
+      private:
+        struct Prefix {
+            ipx_t address;
+            std::uint8_t length;
+            std::uint32_t value;
+        };
+
+        sfap::result<PrefixTable> build(const MemoryOptions* options) const noexcept;
+
+        Buffer prefixes_{growable}; ///< Prefix records, appended as raw bytes.
+    };
+
+    /// \brief Constructs an empty table that matches nothing.
+    PrefixTable() noexcept = default;
+
+    PrefixTable(PrefixTable&&) noexcept = default;
+    PrefixTable(const PrefixTable&) = delete;
+
+    PrefixTable& operator=(PrefixTable&&) noexcept = default;
+    PrefixTable& operator=(const PrefixTable&) = delete;
+
+    /*!
+      \brief Find the longest prefix covering \p address.
+      \return Value of that prefix, `std::nullopt` if none covers it.
+    */
+    std::optional<std::uint32_t> lookup(const ipx_t& address) const noexcept;
+
+    /// \return `true` if any prefix covers \p address.
+    bool contains(const ipx_t& address) const noexcept;
+
+    /// \return Number of distinct prefixes in the table.
+    std::size_t size() const noexcept;
+
+    /// \return Bytes used by trie nodes.
+    std::size_t memory_usage() const noexcept;
+
+  private:
+    Buffer nodes_{0};    ///< Node entries, node 0 is the IPv4 root and node 1 the IPv6 root.
+    std::size_t size_{}; ///< Distinct prefixes.
+};
+
+} // namespace sfap::net
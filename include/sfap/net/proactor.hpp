@@ -2,17 +2,26 @@
 
 #include <chrono>
 #include <span>
+#include <string_view>
 
 #include <sfap/error.hpp>
 #include <sfap/net/address.hpp>
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/socket_options.hpp>
 #include <sfap/net/types.hpp>
+#include <sfap/utils/executor.hpp>
 #include <sfap/utils/task.hpp>
 
 namespace sfap::net {
 
 class Socket;
 
-class Proactor {
+namespace dns {
+struct Config;
+}
+
+class Proactor : public Executor {
   public:
     using clock = std::chrono::steady_clock;
     using duration = clock::duration;
@@ -26,11 +35,114 @@ class Proactor {
     virtual void run() noexcept = 0;
     virtual void stop() noexcept = 0;
 
-    virtual sfap::task<sfap::result<Socket>> connect(const Address& address, duration timeout = duration::max()) noexcept = 0;
+    /// \brief Open a TCP connection to \p address with \p options applied before connecting.
+    virtual sfap::task<sfap::result<Socket>> connect(const Address& address, duration timeout = duration::max(),
+                                                     const SocketOptions& options = {}) noexcept = 0;
     virtual void close(socket_t id) noexcept = 0;
+
+    /*!
+      \brief Open a TCP socket of \p peer's family with \p options applied, without connecting it.
+      \details Together with socket_connect() this lets the caller know the
+               socket, and so cancel() it, while the handshake is in flight.
+    */
+    virtual sfap::result<Socket> open_stream(const Address& peer, const SocketOptions& options = {}) noexcept = 0;
+
+    /// \brief Connect socket \p id from open_stream() to \p address.
+    virtual sfap::task<error_code> socket_connect(socket_t id, const Address& address,
+                                                  duration timeout = duration::max()) noexcept = 0;
+
+    /*!
+      \brief Abort every operation in flight on socket \p id.
+      \details The operations complete with `ECANCELED`; the socket stays open.
+    */
+    virtual void cancel(socket_t id) noexcept = 0;
+
+    /*!
+      \brief Check without blocking that stream socket \p id is still usable.
+      \return `false` if the peer closed or reset the connection, or sent data
+              nobody asked for.
+    */
+    virtual bool socket_alive(socket_t id) noexcept = 0;
+
     virtual sfap::task<error_code> sleep_for(duration d) noexcept = 0;
     virtual sfap::task<result<std::size_t>> socket_send(socket_t id, std::span<const std::byte> data) noexcept = 0;
+    virtual sfap::task<result<std::size_t>> socket_sendv(socket_t id,
+                                                         std::span<const std::span<const std::byte>> data) noexcept = 0;
     virtual sfap::task<result<std::size_t>> socket_recv(socket_t id, std::span<std::byte> data) noexcept = 0;
+
+    /*!
+      \brief Open a UDP socket connected to \p peer.
+      \details Connecting a datagram socket only sets its default destination,
+               so this completes immediately.
+    */
+    virtual sfap::result<Socket> connect_datagram(const Address& peer) noexcept = 0;
+
+    /*!
+      \brief Like socket_recv(), but give up after \p timeout.
+      \return Bytes received, or a network error with `ETIMEDOUT` when the time ran out.
+    */
+    virtual sfap::task<result<std::size_t>> socket_recv_for(socket_t id, std::span<std::byte> data,
+                                                            duration timeout) noexcept = 0;
+
+    /*!
+      \brief Resolve \p host without blocking the loop.
+
+      \details IP literals are answered directly and names listed in the hosts
+               file without any traffic. Otherwise A and/or AAAA queries, as
+               \p mode needs, are sent together over UDP to each name server in
+               turn, retried `attempts` times and fetched again over TCP when
+               truncated. Relative names go through the search list.
+
+      \param host Hostname or IP literal; must stay valid until the task completes.
+      \param mode Family selection, as for sfap::net::resolve().
+      \return Address, a `dns` error such as `NAME_ERROR`, `NO_DATA` or `TIMEOUT`,
+              or `errc::INVALID_ARGUMENT` for a malformed name.
+    */
+    sfap::task<sfap::result<ipx_t>> resolve(std::string_view host,
+                                            ResolveMode mode = config::default_resolve_mode) noexcept;
+
+    /// \brief Resolve \p host using \p config instead of dns::Config::system(); \p config must outlive the task.
+    sfap::task<sfap::result<ipx_t>> resolve(std::string_view host, ResolveMode mode,
+                                            const dns::Config& config) noexcept;
+
+    /*!
+      \brief Like resolve(), but return every address, preferred family first.
+      \details Under the PREFER_* modes both families are always queried.
+    */
+    sfap::task<sfap::result<AddressList>> resolve_all(std::string_view host,
+                                                      ResolveMode mode = config::default_resolve_mode) noexcept;
+    sfap::task<sfap::result<AddressList>> resolve_all(std::string_view host, ResolveMode mode,
+                                                      const dns::Config& config) noexcept;
+
+    /// \brief Delay between starting connection attempts in connect_any() (RFC 8305 section 5).
+    static constexpr duration connection_attempt_delay{std::chrono::milliseconds{250}};
+
+    /*!
+      \brief Connect to \p host on \p port over whichever address answers first ("Happy Eyeballs", RFC 8305).
+
+      \details Resolves every address of \p host, interleaves the families
+               starting with the preferred one and starts one attempt every
+               `connection_attempt_delay`, or at once when the previous attempt
+               fails. The first established connection wins and the attempts
+               still in flight are cancelled.
+
+               The family that won last time for \p host is preferred on the
+               next call over the one \p mode prefers, so a host with a
+               broken IPv6 route costs the stagger delay only once.
+
+      \param host    Hostname or IP literal; must stay valid until the task completes.
+      \param port    Port to connect to.
+      \param mode    Families to use and the default preference.
+      \param timeout Limit for each attempt, `duration::max()` for the system default.
+      \return Connected socket, the error of the last failed attempt, or the resolution error.
+    */
+    sfap::task<sfap::result<Socket>> connect_any(std::string_view host, port_t port,
+                                                 ResolveMode mode = config::default_resolve_mode,
+                                                 duration timeout = duration::max()) noexcept;
+
+    /// \brief connect_any() resolving through \p config; \p config must outlive the task.
+    sfap::task<sfap::result<Socket>> connect_any(std::string_view host, port_t port, ResolveMode mode,
+                                                 duration timeout, const dns::Config& config) noexcept;
 };
 
 } // namespace sfap::net
\ No newline at end of file
@@ -9,7 +9,12 @@
 
 #pragma once
 
+#include <span>
+
+#include <cstddef>
+
 #include <sfap/error.hpp>
+#include <sfap/net/address_list.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/string.hpp>
 
@@ -71,6 +76,10 @@ extern ResolveMode default_resolve_mode;
   to select the final address from the list returned by the system
   resolver.
 
+  Hostname results are cached in ResolveCache::global() (see
+  sfap/net/resolve_cache.hpp), so repeated lookups of the same name do not
+  reach getaddrinfo until their TTL runs out.
+
   \param address Hostname or textual IP address to resolve.
   \param mode Resolution policy controlling IPv4/IPv6 selection.
   \return An @c sfap::expected containing:
@@ -80,4 +89,67 @@ extern ResolveMode default_resolve_mode;
 sfap::result<ipx_t> resolve(const String& address, ResolveMode mode = config::default_resolve_mode) noexcept;
 sfap::result<ipx_t> resolve(const char* address, ResolveMode mode = config::default_resolve_mode) noexcept;
 
-} // namespace sfap::net
\ No newline at end of file
+/// \return getaddrinfo() status \p code as an error in the `resolve` category.
+sfap::unexpected<sfap::error_code> resolve_error(int code) noexcept;
+
+/*!
+  \return `true` if \p error says the name has no addresses (`EAI_NONAME`,
+          `EAI_NODATA`, `EAI_ADDRFAMILY`). Such answers are worth caching. Others, such as
+          `EAI_AGAIN` or `EAI_SYSTEM`, may clear up on the next try.
+*/
+bool is_negative_answer(const sfap::error_code& error) noexcept;
+
+/*!
+  \brief Resolves like resolve(), but always asks the system resolver.
+
+  resolve() answers numeric literals directly and hostnames through
+  ResolveCache::global(); this function is what that cache calls on a miss.
+*/
+sfap::result<ipx_t> resolve_uncached(const char* address,
+                                     ResolveMode mode = config::default_resolve_mode) noexcept;
+
+/*!
+  \brief Resolves a hostname or textual IP address to every address it has.
+
+  Unlike resolve(), nothing from the system resolver is dropped, so callers
+  can spread connections over all replicas, e.g. through AddressSet.
+  Duplicates are removed and system resolver order is kept within a family.
+  Under the PREFER_* modes the preferred family comes first; under the
+  REQUIRE_* modes the other family is left out. Results are not cached.
+
+  \param address Hostname or textual IP address to resolve.
+  \param mode Resolution policy controlling IPv4/IPv6 selection and order.
+  \return Non-empty list, a `resolve` error, or `errc::NOT_ENOUGH_MEMORY`.
+*/
+sfap::result<AddressList> resolve_all(const String& address,
+                                      ResolveMode mode = config::default_resolve_mode) noexcept;
+sfap::result<AddressList> resolve_all(const char* address, ResolveMode mode = config::default_resolve_mode) noexcept;
+
+/// \brief Lookups resolve_batch() runs at once unless told otherwise.
+inline constexpr std::size_t default_resolve_parallelism{16};
+
+/*!
+  \brief Resolves many hostnames at once, like resolve() on each.
+
+  Identical names are looked up once. The distinct names are spread over
+  up to \p parallelism threads, the calling thread included, each running
+  resolve() in turn, so a batch of slow lookups takes roughly the time of
+  the slowest ones instead of their sum. Answers go through
+  ResolveCache::global() like any other resolve() call.
+
+  Nothing here throws: if a helper thread cannot be started the batch goes
+  on with the threads it has, and if there is no memory to group duplicates
+  every name is resolved in turn on the calling thread.
+
+  \param addresses   Hostnames or textual IP addresses.
+  \param results     Receives one result per input, in input order.
+  \param mode        Resolution policy controlling IPv4/IPv6 selection.
+  \param parallelism Most lookups in flight; `0` is treated as `1`.
+  \return sfap::no_error(), or `errc::INVALID_ARGUMENT` if \p results and
+          \p addresses differ in size.
+*/
+sfap::error_code resolve_batch(std::span<const String> addresses, std::span<sfap::result<ipx_t>> results,
+                               ResolveMode mode = config::default_resolve_mode,
+                               std::size_t parallelism = default_resolve_parallelism) noexcept;
+
+} // namespace sfap::net
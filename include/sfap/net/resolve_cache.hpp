@@ -0,0 +1,178 @@
+/*!
+  \file
+  \brief Hostname resolution cache interface.
+
+  \details
+  Sharded LRU cache in front of the blocking resolver with positive and
+  negative TTLs and refresh-ahead for hot entries.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/types.hpp>
+
+namespace sfap::net {
+
+/// \brief Tuning of a ResolveCache.
+struct ResolveCacheOptions {
+    using duration = std::chrono::milliseconds;
+
+    /// \brief Blocking resolver consulted on misses and refreshes.
+    using Resolver = sfap::result<ipx_t> (*)(const char* hostname, ResolveMode mode) noexcept;
+
+    std::size_t capacity{4096};           ///< Maximum entries over all shards; least recently used go first.
+    duration positive_ttl{30000};         ///< Lifetime of successful lookups.
+    duration negative_ttl{5000};          ///< Lifetime of lookups that found no such name.
+    double refresh_ahead{0.2};            ///< Refresh hot entries in this last fraction of their TTL; `0` disables.
+    std::uint32_t refresh_min_hits{2};    ///< Hits since the last resolution that make an entry hot.
+    Resolver resolver{&resolve_uncached}; ///< Where answers come from.
+};
+
+/*!
+  \brief Thread-safe cache of hostname resolutions keyed by hostname and ResolveMode.
+
+  \details Entries are spread over `shard_count` shards by hash, each with its
+           own lock and LRU list, so the total size never exceeds
+           `capacity` (rounded up to a multiple of `shard_count`). Locks are
+           never held while resolving.
+
+           `getaddrinfo` does not report record TTLs, so lifetimes come from
+           the options. A hot entry hit in the last `refresh_ahead` part of its
+           lifetime is resolved again by that one caller while every other
+           caller keeps getting the cached answer, so hot names never expire
+           under load. A failed refresh keeps the old answer until it expires
+           and postpones the next attempt by half the refresh window, so a
+           resolver outage does not put every hit back on the slow path.
+
+           Only definitive failures are cached, see is_negative_answer();
+           transient ones such as `EAI_AGAIN` reach the resolver again on the
+           next call.
+
+           A shard allocates its entries and index once, on first store,
+           with `new (std::nothrow)`. If that fails the resolver's answer is
+           returned without being cached. Hostnames longer than
+           `max_hostname_size` are never cached.
+
+  \par Thread-safety
+  All member functions may be called concurrently.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class ResolveCache {
+
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /// \brief Number of independently locked shards.
+    static constexpr std::size_t shard_count{16};
+
+    /// \brief Longest hostname that is cached.
+    static constexpr std::size_t max_hostname_size{255};
+
+    /// \brief Counter snapshot.
+    struct Stats {
+        std::uint64_t hits;          ///< Answers served from a live positive entry.
+        std::uint64_t negative_hits; ///< Failures served from a live negative entry.
+        std::uint64_t misses;        ///< Lookups that had to resolve.
+        std::uint64_t refreshes;     ///< Refresh-ahead resolutions.
+        std::uint64_t evictions;     ///< Entries dropped to stay within capacity.
+        std::size_t size;            ///< Entries currently held.
+    };
+
+    explicit ResolveCache(const ResolveCacheOptions& options = {}) noexcept;
+    ~ResolveCache() noexcept;
+
+    ResolveCache(ResolveCache&&) = delete;
+    ResolveCache(const ResolveCache&) = delete;
+
+    ResolveCache& operator=(ResolveCache&&) = delete;
+    ResolveCache& operator=(const ResolveCache&) = delete;
+
+    /// \return Process-wide cache used by resolve().
+    static ResolveCache& global() noexcept;
+
+    /*!
+      \brief Resolve \p hostname, from the cache when possible.
+      \return Same as the configured resolver.
+      \note Null input goes straight to the resolver and is not cached.
+    */
+    sfap::result<ipx_t> resolve(const char* hostname, ResolveMode mode) noexcept;
+
+    /// \brief Drop every entry. Counters are kept.
+    void clear() noexcept;
+
+    /// \return Current counters.
+    Stats stats() const noexcept;
+
+  private:
+    struct Entry {
+        std::array<char, max_hostname_size + 1> key; ///< Mode byte followed by the hostname.
+        std::size_t key_size;
+        std::size_t hash;
+        sfap::result<ipx_t> value;
+        clock::time_point expires;
+        clock::time_point refresh_at;
+        std::uint32_t hits;
+        bool refreshing;
+        Entry* newer; ///< LRU neighbour towards the most recently used entry.
+        Entry* older; ///< LRU neighbour towards the least recently used entry.
+
+        std::string_view view() const noexcept {
+            return {key.data(), key_size};
+        }
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        Entry* entries{};      ///< `shard_capacity_` entries, allocated on first store.
+        std::size_t size{};    ///< Entries in use; always the first `size` of `entries`.
+        Entry* newest{};       ///< LRU head.
+        Entry* oldest{};       ///< LRU tail, evicted first.
+        Entry** index{};       ///< Open-addressed by hash with linear probing, `nullptr` marks a free slot.
+        std::size_t mask{};    ///< Index slots minus one.
+    };
+
+    /// \return Entry for \p key in \p shard, `nullptr` if absent.
+    static Entry* find(const Shard& shard, std::string_view key, std::size_t hash) noexcept;
+
+    /// \brief Move \p entry to the front of the LRU list of \p shard.
+    static void touch(Shard& shard, Entry* entry) noexcept;
+
+    /// \brief Remove \p entry from the index and LRU list of \p shard.
+    static void unlink(Shard& shard, Entry* entry) noexcept;
+
+    /*!
+      \brief Store \p value for \p key, evicting the least recently used entry if full.
+      \return `false` if the shard storage could not be allocated; nothing is cached then.
+    */
+    bool store(Shard& shard, std::string_view key, std::size_t hash, const sfap::result<ipx_t>& value,
+               clock::time_point now) noexcept;
+
+    ResolveCacheOptions options_;
+    std::size_t shard_capacity_;
+    std::array<Shard, shard_count> shards_;
+
+    std::atomic<std::uint64_t> hits_{};
+    std::atomic<std::uint64_t> negative_hits_{};
+    std::atomic<std::uint64_t> misses_{};
+    std::atomic<std::uint64_t> refreshes_{};
+    std::atomic<std::uint64_t> evictions_{};
+};
+
+} // namespace sfap::net
@@ -4,7 +4,10 @@
 
 #include <cstddef>
 
+#include <sfap/error.hpp>
 #include <sfap/net/types.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
 #include <sfap/utils/task.hpp>
 
 namespace sfap::net {
@@ -29,7 +32,30 @@ class Socket {
 
     socket_t get_handle() const noexcept;
 
-    task<void> send_bytes(std::span<const std::byte> data) noexcept;
+    /*!
+      \brief Send all of \p data, looping over partial sends.
+      \return Bytes sent, or the error of the first failing send. A send that
+              makes no progress fails with `EPIPE`.
+    */
+    task<result<std::size_t>> send_bytes(std::span<const std::byte> data) noexcept;
+
+    /*!
+      \brief Send \p data, holding its reference until the last send completes.
+      \return As for the span overload.
+    */
+    task<result<std::size_t>> send_bytes(BufferSlice data) noexcept;
+
+    /*!
+      \brief Send every segment of \p data with vectored sends.
+      \details Up to `max_send_segments` segments go out per syscall; the
+               chain is owned by the coroutine until everything is sent.
+      \return Bytes sent, or the error of the first failing send. A send that
+              makes no progress fails with `EPIPE`.
+    */
+    task<result<std::size_t>> send_bytes(BufferChain data) noexcept;
+
+    /// \brief Segments passed to one `Proactor::socket_sendv()` call.
+    static constexpr std::size_t max_send_segments{64};
     task<void> recv_bytes(std::span<std::byte> data, bool exact = true) noexcept;
 
   private:
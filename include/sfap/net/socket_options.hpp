@@ -0,0 +1,51 @@
+/*!
+  \file
+  \brief Per-connection TCP socket options.
+
+  \details
+  Settings applied to a stream socket between its creation and its
+  connect, where buffer sizes still influence the negotiated window.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <sfap/error.hpp>
+
+namespace sfap::net {
+
+/*!
+  \brief Options for new TCP connections.
+  \details Zero and `false` leave the system default in place, so a
+           default-constructed value changes nothing.
+*/
+struct SocketOptions {
+    bool no_delay{false};  ///< `TCP_NODELAY`: send small writes at once instead of coalescing them (Nagle).
+    int send_buffer{0};    ///< `SO_SNDBUF` in bytes. Linux doubles it for bookkeeping.
+    int receive_buffer{0}; ///< `SO_RCVBUF` in bytes. Linux doubles it for bookkeeping.
+    int not_sent_lowat{0}; ///< `TCP_NOTSENT_LOWAT`: unsent bytes above which the socket stops being writable.
+
+    /*!
+      \brief TCP Fast Open through `TCP_FASTOPEN_CONNECT`.
+      \details With a cookie cached from an earlier connection to the same
+               server, connect completes at once and the SYN goes out with
+               the first send, carrying its data and saving a round trip.
+               Without one, a normal handshake also fetches a cookie.
+               Connection errors may then surface on the first send instead
+               of on connect. Needs Linux 4.11+ and `net.ipv4.tcp_fastopen`
+               bit 1 set.
+    */
+    bool fast_open{false};
+};
+
+/*!
+  \brief Apply \p options to stream socket \p fd.
+  \return No error, or the network error of the first option the kernel refused;
+          `ENOPROTOOPT` when the platform lacks an option.
+*/
+error_code apply_socket_options(int fd, const SocketOptions& options) noexcept;
+
+} // namespace sfap::net
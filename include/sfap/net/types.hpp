@@ -13,9 +13,13 @@
 #pragma once
 
 #include <array>
-#include <variant>
+#include <bit>
+#include <compare>
+#include <functional>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include <sfap/utils/expected.hpp>
 #include <sfap/utils/string.hpp>
@@ -34,58 +38,155 @@ using ip4_t = std::array<std::uint8_t, 4>;
 /// \brief IPv6 address represented as 16 bytes in network byte order.
 using ip6_t = std::array<std::uint8_t, 16>;
 
+namespace detail {
+
+/// \brief 64x64 -> 128 bit multiply folded to 64 bits, the wyhash mixing step.
+constexpr std::uint64_t wymix(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using u128 = unsigned __int128;
+    const u128 product{static_cast<u128>(a) * b};
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t a_lo{a & 0xFFFFFFFF}, a_hi{a >> 32}, b_lo{b & 0xFFFFFFFF}, b_hi{b >> 32};
+    const std::uint64_t lo_lo{a_lo * b_lo}, hi_lo{a_hi * b_lo}, lo_hi{a_lo * b_hi}, hi_hi{a_hi * b_hi};
+    const std::uint64_t cross{(lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi};
+    const std::uint64_t hi{hi_hi + (hi_lo >> 32) + (cross >> 32)};
+    const std::uint64_t lo{(cross << 32) | (lo_lo & 0xFFFFFFFF)};
+    return lo ^ hi;
+#endif
+}
+
+inline constexpr std::uint64_t wyseed0{0xa0761d6478bd642f};
+inline constexpr std::uint64_t wyseed1{0xe7037ed1a0b428db};
+
+} // namespace detail
+
 /*!
   \brief Generic IPv4/IPv6 address holder.
-  Stores either an IPv4 or IPv6 address using `std::variant`.
-  Provides access to raw byte data and address family information.
+  Stores 16 address bytes and a family tag. IPv4 addresses are kept in
+  IPv4-mapped form (`::ffff:a.b.c.d`), so `data()` and `size()` are plain
+  offset arithmetic and the whole value compares and hashes as two words.
+
+  All members are `constexpr`, so addresses can be built and compared at
+  compile time, e.g. with the literals in sfap/net/parse_ip.hpp.
 */
 class ipx_t {
   public:
+    /// \brief IP address family type.
+    enum class Family : std::uint8_t { V4, V6 };
+
     /// \brief Constructs a default IPv4 address (`0.0.0.0`).
-    explicit ipx_t() noexcept;
+    constexpr explicit ipx_t() noexcept : ipx_t(ip4_t{}) {}
 
     /// \brief Constructs from an IPv4 address.
-    explicit ipx_t(const ip4_t& ip4) noexcept;
+    constexpr explicit ipx_t(const ip4_t& ip4) noexcept
+        : family_(Family::V4), bytes_{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, ip4[0], ip4[1], ip4[2], ip4[3]} {}
 
     /// \brief Constructs from an IPv6 address.
-    explicit ipx_t(const ip6_t& ip6) noexcept;
-
-    /// \brief IP address family type.
-    enum class Family { V4, V6 };
+    constexpr explicit ipx_t(const ip6_t& ip6) noexcept : family_(Family::V6), bytes_(ip6) {}
 
     /// \brief Get address family type.
-    Family family() const noexcept;
+    constexpr Family family() const noexcept {
+        return family_;
+    }
 
     /// \return `true` if IPv4.
-    bool is_4() const noexcept;
+    constexpr bool is_4() const noexcept {
+        return family_ == Family::V4;
+    }
 
     /// \return `true` if IPv6.
-    bool is_6() const noexcept;
+    constexpr bool is_6() const noexcept {
+        return family_ == Family::V6;
+    }
 
     /*!
       \brief Returns the IPv4 address.
       \warning Call only if `family() == Family::V4`.
-               Undefined behavior (terminate) otherwise.
+               Returns the last four bytes of an IPv6 address otherwise.
     */
-    const ip4_t& get_4() const noexcept;
+    constexpr ip4_t get_4() const noexcept {
+        return {bytes_[12], bytes_[13], bytes_[14], bytes_[15]};
+    }
 
     /*!
       \brief Returns the IPv6 address.
       \warning Call only if `family() == Family::V6`.
-               Undefined behavior (terminate) otherwise.
+               Returns the IPv4-mapped form of an IPv4 address otherwise.
     */
-    const ip6_t& get_6() const noexcept;
+    constexpr const ip6_t& get_6() const noexcept {
+        return bytes_;
+    }
+
+    /// \return The address as IPv6; IPv4 addresses in `::ffff:a.b.c.d` form.
+    constexpr const ip6_t& as_6() const noexcept {
+        return bytes_;
+    }
 
     /// \return Pointer to underlying address bytes.
-    const std::uint8_t* data() const noexcept;
+    constexpr const std::uint8_t* data() const noexcept {
+        return bytes_.data() + v4_offset();
+    }
 
     /// \return 4 for IPv4, 16 for IPv6.
-    std::size_t size() const noexcept;
-
-    static bool is_any(const ipx_t& ip) noexcept;
+    constexpr std::size_t size() const noexcept {
+        return bytes_.size() - v4_offset();
+    }
+
+    /// \return `true` if \p ip is the unspecified address (`0.0.0.0` or `::`).
+    static constexpr bool is_any(const ipx_t& ip) noexcept {
+        const auto [high, low] = ip.words();
+        // IPv4 keeps 0xFFFF in bytes 10-11, in front of its four bytes; mask it away.
+        const std::uint64_t mapped_prefix{ip.is_4() ? std::uint64_t{0xFFFF} << 32 : 0};
+        return high == 0 && (low & ~mapped_prefix) == 0;
+    }
+
+    /// \return wyhash-style hash of family and bytes.
+    constexpr std::uint64_t hash() const noexcept {
+        const auto [high, low] = words();
+        return detail::wymix(high ^ detail::wyseed0, low ^ detail::wyseed1 ^ static_cast<std::uint64_t>(family_));
+    }
+
+    /// \brief Same family and same bytes. `1.2.3.4` and `::ffff:1.2.3.4` differ.
+    friend constexpr bool operator==(const ipx_t& a, const ipx_t& b) noexcept {
+        return a.family_ == b.family_ && a.words() == b.words();
+    }
+
+    /// \brief All IPv4 addresses order before IPv6 ones, then bytewise (numeric) order.
+    friend constexpr std::strong_ordering operator<=>(const ipx_t&, const ipx_t&) noexcept = default;
 
   private:
-    std::variant<ip4_t, ip6_t> address_; ///< Address storage.
+    constexpr std::size_t v4_offset() const noexcept {
+        return static_cast<std::size_t>(family_ == Family::V4) * (sizeof(ip6_t) - sizeof(ip4_t));
+    }
+
+    /// \return The 16 bytes as two big-endian words, high first.
+    constexpr std::array<std::uint64_t, 2> words() const noexcept {
+        std::array<std::uint64_t, 2> words{};
+        if consteval {
+            for (std::size_t i = 0; i < 8; ++i) {
+                words[0] = (words[0] << 8) | bytes_[i];
+                words[1] = (words[1] << 8) | bytes_[i + 8];
+            }
+        } else {
+            std::memcpy(words.data(), bytes_.data(), sizeof(words));
+            if constexpr (std::endian::native == std::endian::little) {
+                words[0] = std::byteswap(words[0]);
+                words[1] = std::byteswap(words[1]);
+            }
+        }
+        return words;
+    }
+
+    Family family_; ///< Address family, compared first.
+    ip6_t bytes_;   ///< IPv6 bytes, or IPv4-mapped IPv6 bytes.
 };
 
-} // namespace sfap::net
\ No newline at end of file
+} // namespace sfap::net
+
+/// \brief Hash for unordered containers keyed by IP address.
+template <> struct std::hash<sfap::net::ipx_t> {
+    std::size_t operator()(const sfap::net::ipx_t& ip) const noexcept {
+        return static_cast<std::size_t>(ip.hash());
+    }
+};
@@ -3,7 +3,9 @@
   \brief Buffer interface.
 
   \details
-  Simple dynamically allocated, fixed size byte buffer.
+  Dynamically allocated byte buffer. Fixed capacity by default; buffers
+  constructed with `growable` reallocate on demand, large ones through
+  `mremap`.
 
   \copyright Copyright (c) 2025 Wiktor Sołtys
 
@@ -16,18 +18,40 @@
 #include <span>
 
 #include <cstddef>
+#include <cstdint>
+
+#include <sfap/utils/memory.hpp>
 
 namespace sfap {
 
+class BufferPool;
+
+/// \brief Tag selecting the growable `Buffer` constructor.
+struct growable_t {
+    explicit growable_t() = default;
+};
+
+/// \brief Tag value selecting the growable `Buffer` constructor.
+inline constexpr growable_t growable{};
+
 /*!
   \brief Byte buffer with optional ownership and move-only semantics.
   \details Owns memory when constructed with capacity. Acts as non-owning
            view when constructed from external span. Copying disabled.
            Size is the logical used length, not capacity.
+
+           Buffers constructed with `growable` reallocate instead of failing
+           when `append()`, `push_back()`, `assign()` or `resize()` need more
+           room. Capacity grows geometrically; from `page_growth_threshold`
+           on the storage is a page mapping grown with `mremap`, so large
+           buffers grow without copying.
 */
 class Buffer {
 
   public:
+    /// \brief Capacity from which growable buffers move to a page mapping.
+    static constexpr std::size_t page_growth_threshold{std::size_t{1} << 20};
+
     /*!
       \brief Construct owning buffer with given capacity.
       \param capacity Number of bytes to allocate. `0` yields null buffer.
@@ -35,6 +59,26 @@ class Buffer {
     */
     explicit Buffer(std::size_t capacity) noexcept;
 
+    /*!
+      \brief Construct owning buffer backed by a page mapping.
+      \param capacity Minimum number of bytes. `0` yields null buffer.
+      \param options Huge page, NUMA and pre-fault hints, see `allocate_pages()`.
+      \post `capacity()` is \p capacity rounded up to the page size in use.
+      \note On failure capacity becomes 0.
+    */
+    Buffer(std::size_t capacity, const MemoryOptions& options) noexcept;
+
+    /*!
+      \brief Construct owning buffer leased from \p pool.
+      \param capacity Minimum number of bytes. `0` yields null buffer.
+      \param pool Pool the block is taken from and returned to on destruction.
+                  Must outlive the buffer.
+      \post `capacity()` is `BufferPool::block_size(capacity)`. Capacities above
+            `BufferPool::max_block_size` are allocated on the heap instead.
+      \note On failure capacity becomes 0.
+    */
+    Buffer(std::size_t capacity, BufferPool& pool) noexcept;
+
     /*!
       \brief Construct non-owning view over external memory.
       \param external Span to external storage. Null or empty yields null buffer.
@@ -42,6 +86,13 @@ class Buffer {
     */
     explicit Buffer(std::span<std::byte> external) noexcept;
 
+    /*!
+      \brief Construct owning buffer that grows on demand.
+      \param capacity Initial capacity. `0` allocates nothing until first use.
+      \note On allocation failure the buffer is null and not growable.
+    */
+    explicit Buffer(growable_t, std::size_t capacity = 0) noexcept;
+
     /// \brief Move construct. Source becomes empty non-owning buffer.
     Buffer(Buffer&&) noexcept;
 
@@ -90,10 +141,30 @@ class Buffer {
     */
     void clean() noexcept;
 
+    /// \return `true` if the buffer was constructed with `growable`.
+    bool is_growable() const noexcept;
+
+    /*!
+      \brief Ensure room for \p n bytes.
+      \param n Required capacity in bytes.
+      \return `true` if `capacity() >= n` afterwards. Only growable buffers reallocate,
+              to at least twice the previous capacity.
+      \post Contents and `size()` are preserved.
+    */
+    bool reserve(std::size_t n) noexcept;
+
+    /*!
+      \brief Release unused capacity of a growable buffer.
+      \return `true` on success or if there is nothing to do. `false` for non-growable buffers or
+              on allocation failure, leaving the buffer unchanged.
+      \post `capacity()` is `size()` rounded up to the page size for mapped storage.
+    */
+    bool shrink_to_fit() noexcept;
+
     /*!
       \brief Change logical size.
       \param n New size in bytes.
-      \return `true` on success. `false` if `n > capacity()`.
+      \return `true` on success. `false` if `n > capacity()` and the buffer cannot grow.
       \note Does not initialize or erase bytes.
       \post `size() == n`
     */
@@ -150,9 +221,9 @@ class Buffer {
     /*!
       \brief Replace buffer contents with \p source.
       \param source Bytes to copy into the buffer.
-      \return `true` on success, `false` if buffer is null or \p source.size() > capacity().
+      \return `true` on success, `false` if buffer is null or \p source.size() > capacity() and the buffer cannot grow.
       \post `size() == source.size()` on success; unchanged on failure.
-      \note Copies raw bytes; does not allocate.
+      \note Copies raw bytes; allocates only when growable.
       \details If \p source is empty, the buffer is cleared (`size()` becomes `0`).
     */
     bool assign(std::span<const std::byte> source) noexcept;
@@ -160,7 +231,8 @@ class Buffer {
     /*!
       \brief Append \p source to the end of current contents.
       \param source Bytes to append.
-      \return true on success, false if buffer is null or size() + source.size() > capacity().
+      \return true on success, false if buffer is null or size() + source.size() > capacity() and the buffer
+      cannot grow.
       \post size() increased by \p source.size() on success; unchanged on failure.
       \note No-op for an empty \p source.
     */
@@ -169,7 +241,7 @@ class Buffer {
     /*!
       \brief Append a single byte.
       \param byte Value to push.
-      \return `true` on success, `false` if buffer is null or `full()`.
+      \return `true` on success, `false` if buffer is null or `full()` and the buffer cannot grow.
       \post `size()` increased by 1 on success; unchanged on failure.
     */
     bool push_back(std::byte byte) noexcept;
@@ -194,9 +266,26 @@ class Buffer {
     std::optional<std::span<const std::byte>> subview(std::size_t from, std::size_t count = 0) const noexcept;
 
   private:
+    /// \brief Origin of `data_`, decides how it is released.
+    enum class Storage : std::uint8_t {
+        EXTERNAL, ///< Not owned.
+        HEAP,     ///< `new[]`.
+        PAGES,    ///< `allocate_pages()`.
+        POOLED,   ///< `BufferPool::acquire()` of `pool_`.
+        MALLOC,   ///< `std::malloc()`, growable below `page_growth_threshold`.
+    };
+
+    /// \brief Free owned storage, if any.
+    void release() noexcept;
+
+    /// \brief Move contents of a growable buffer to storage of \p capacity bytes.
+    bool reallocate(std::size_t capacity) noexcept;
+
     std::byte* data_{};      ///< Base pointer.
     std::size_t capacity_{}; ///< Capacity in bytes (power of two).
-    bool owner_{};           ///< Owns `data_` and frees on destruction.
+    Storage storage_{};      ///< Owns `data_` unless `EXTERNAL`.
+    BufferPool* pool_{};     ///< Pool `data_` is returned to when `POOLED`.
+    bool growable_{};        ///< Reallocates instead of failing when full.
 
     std::size_t size_{}; ///< Used bytes.
 };
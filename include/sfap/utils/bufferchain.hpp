@@ -0,0 +1,139 @@
+/*!
+  \file
+  \brief Buffer chain interface.
+
+  \details
+  Linked sequence of shared byte segments for assembling messages from
+  separately produced parts without copying.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <span>
+
+#include <cstddef>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+
+namespace sfap {
+
+/*!
+  \brief Rope of `BufferSlice` segments.
+  \details Appending and prepending link a segment without copying bytes.
+           `gather()` exports the segments for a vectored send; `consume()`
+           drops sent bytes from the front. `coalesce()` copies everything
+           into one segment when a contiguous view is needed. Empty segments
+           are never stored.
+
+  \par Exceptions
+  All functions are `noexcept`. Operations that allocate report failure by
+  returning `false` and leave the chain unchanged.
+*/
+class BufferChain {
+
+  public:
+    /// \brief Construct empty chain.
+    BufferChain() noexcept = default;
+
+    /// \brief Move construct. Source becomes empty.
+    BufferChain(BufferChain&& other) noexcept;
+
+    BufferChain(const BufferChain&) = delete;
+    ~BufferChain() noexcept;
+
+    /// \brief Move assign. Drops current segments then takes those of source.
+    BufferChain& operator=(BufferChain&& other) noexcept;
+
+    BufferChain& operator=(const BufferChain&) = delete;
+
+    /// \return Total number of bytes.
+    std::size_t size() const noexcept;
+
+    /// \return Number of segments.
+    std::size_t segments() const noexcept;
+
+    /// \return `true` if `size() == 0`.
+    bool empty() const noexcept;
+
+    /*!
+      \brief Link \p slice after the last segment.
+      \return `false` on allocation failure. Empty \p slice is a no-op.
+    */
+    bool append(BufferSlice slice) noexcept;
+
+    /*!
+      \brief Take over \p buffer and link its used bytes after the last segment.
+      \return `false` on allocation failure. \p buffer is left untouched then.
+              Empty \p buffer is a no-op.
+    */
+    bool append(Buffer&& buffer) noexcept;
+
+    /*!
+      \brief Move all segments of \p other after the last segment.
+      \post \p other is empty.
+    */
+    void append(BufferChain&& other) noexcept;
+
+    /*!
+      \brief Link \p slice before the first segment.
+      \return `false` on allocation failure. Empty \p slice is a no-op.
+    */
+    bool prepend(BufferSlice slice) noexcept;
+
+    /*!
+      \brief Take over \p buffer and link its used bytes before the first segment.
+      \return `false` on allocation failure. \p buffer is left untouched then.
+              Empty \p buffer is a no-op.
+    */
+    bool prepend(Buffer&& buffer) noexcept;
+
+    /// \return Bytes of the first segment, empty span for empty chain.
+    std::span<const std::byte> front() const noexcept;
+
+    /*!
+      \brief Copy all bytes into a single segment.
+      \return `true` if the chain now has at most one segment, `false` on allocation failure.
+    */
+    bool coalesce() noexcept;
+
+    /*!
+      \brief Export segments in order, e.g. to build an `iovec` array.
+      \param out Destination. Filled from the first segment.
+      \return Number of entries written, at most `out.size()`.
+    */
+    std::size_t gather(std::span<std::span<const std::byte>> out) const noexcept;
+
+    /*!
+      \brief Drop \p n bytes from the front.
+      \details Fully consumed segments are released; a partially consumed
+               one is narrowed. \p n larger than `size()` empties the chain.
+    */
+    void consume(std::size_t n) noexcept;
+
+    /// \brief Drop every segment.
+    void clear() noexcept;
+
+  private:
+    struct Node {
+        BufferSlice slice;
+        Node* next{};
+    };
+
+    /// \brief Link \p node after the last segment and account for its bytes.
+    void link_back(Node* node) noexcept;
+
+    /// \brief Link \p node before the first segment and account for its bytes.
+    void link_front(Node* node) noexcept;
+
+    Node* head_{};
+    Node* tail_{};
+    std::size_t segments_{};
+    std::size_t size_{};
+};
+
+} // namespace sfap
@@ -0,0 +1,163 @@
+/*!
+  \file
+  \brief Buffer pool interface.
+
+  \details
+  Size-class allocator for short-lived buffers with per-thread magazines in
+  front of a shared depot.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include <cstddef>
+
+namespace sfap {
+
+/*!
+  \brief Pool of power-of-two byte blocks from `min_block_size` to `max_block_size`.
+
+  \details Each size class has a small magazine (stack of free blocks) per
+           shard and one depot shared by all shards. Threads are spread over
+           `shard_count` shards by a thread-local index fixed on first use,
+           so a shard is normally touched by one thread and its lock is
+           uncontended. An empty magazine refills half from the depot, a full
+           one spills half back; the depot frees blocks beyond its limit.
+           Blocks never move between size classes.
+
+  \par Thread-safety
+  All member functions may be called concurrently.
+
+  \par Lifetime
+  The pool must outlive every block and `Buffer` leased from it.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class BufferPool {
+
+  public:
+    /// \brief Smallest size class in bytes.
+    static constexpr std::size_t min_block_size{std::size_t{1} << 12};
+
+    /// \brief Number of size classes; each doubles the previous one.
+    static constexpr std::size_t class_count{9};
+
+    /// \brief Largest size class in bytes.
+    static constexpr std::size_t max_block_size{min_block_size << (class_count - 1)};
+
+    /// \brief Free blocks a shard keeps per size class.
+    static constexpr std::size_t magazine_size{16};
+
+    /// \brief Number of per-thread shards.
+    static constexpr std::size_t shard_count{16};
+
+    /// \brief Per size class counters.
+    struct Stats {
+        std::size_t block_size{};   ///< Size class in bytes.
+        std::size_t live_bytes{};   ///< Bytes currently leased out.
+        std::size_t cached_bytes{}; ///< Bytes held free in magazines and the depot.
+        std::size_t peak_bytes{};   ///< Highest `live_bytes` seen.
+    };
+
+    /*!
+      \brief Construct an empty pool.
+      \param depot_limit Free blocks the depot keeps per size class before releasing to the heap.
+      \warning On allocation failure `operator bool()` returns `false`.
+    */
+    explicit BufferPool(std::size_t depot_limit = 64) noexcept;
+
+    BufferPool(BufferPool&&) = delete;
+    BufferPool(const BufferPool&) = delete;
+
+    /// \brief Free every cached block.
+    ~BufferPool() noexcept;
+
+    BufferPool& operator=(BufferPool&&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /*!
+      \brief Validity check.
+      \return `true` if the instance is properly initialized.
+     */
+    explicit operator bool() const noexcept;
+
+    /*!
+      \brief Size class serving \p size.
+      \return \p size rounded up to a size class, or `0` if \p size is `0` or above `max_block_size`.
+    */
+    static std::size_t block_size(std::size_t size) noexcept;
+
+    /*!
+      \brief Lease a block of `block_size(size)` bytes.
+      \param size Requested bytes, `1..max_block_size`.
+      \return Block pointer or `nullptr` on invalid size or allocation failure.
+      \note Contents are unspecified.
+    */
+    std::byte* acquire(std::size_t size) noexcept;
+
+    /*!
+      \brief Return a block leased with `acquire()`.
+      \param block Block pointer. `nullptr` is a no-op.
+      \param size Size passed to `acquire()` or its `block_size()`.
+    */
+    void release(std::byte* block, std::size_t size) noexcept;
+
+    /*!
+      \param index Size class index in `[0, class_count)`.
+      \return Counters of the class. Approximate while other threads are active.
+    */
+    Stats stats(std::size_t index) const noexcept;
+
+    /// \brief Free every block cached in magazines and the depot.
+    void trim() noexcept;
+
+  private:
+    /// \brief Assumed cache line size used to keep shards apart.
+    static constexpr std::size_t cache_line_size{64};
+
+    /// \brief Free blocks of one class held by one shard.
+    struct Magazine {
+        std::array<std::byte*, magazine_size> blocks{};
+        std::size_t count{};
+    };
+
+    struct alignas(cache_line_size) Shard {
+        std::mutex mutex;
+        std::array<Magazine, class_count> magazines;
+    };
+
+    /// \brief Shared free list of one class, linked through the blocks themselves.
+    struct Depot {
+        std::mutex mutex;
+        std::byte* head{};
+        std::size_t count{};
+    };
+
+    struct alignas(cache_line_size) Counters {
+        std::atomic<std::size_t> live{};
+        std::atomic<std::size_t> cached{};
+        std::atomic<std::size_t> peak{};
+    };
+
+    static std::size_t class_index(std::size_t size) noexcept;
+    static std::size_t shard_index() noexcept;
+
+    void refill(std::size_t index, Magazine& magazine) noexcept;
+    void spill(std::size_t index, Magazine& magazine) noexcept;
+    void track_live(std::size_t index, std::size_t bytes) noexcept;
+
+    Shard* shards_{};
+    std::array<Depot, class_count> depots_;
+    std::array<Counters, class_count> counters_;
+    std::size_t depot_limit_{};
+};
+
+} // namespace sfap
@@ -0,0 +1,48 @@
+/*!
+  \file
+  \brief Fire-and-forget coroutine type.
+
+  \details
+  For background work such as timers and racing connection attempts whose
+  result is reported through shared state instead of being awaited.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+
+namespace sfap {
+
+/*!
+  \brief Return type of a coroutine that starts at once and frees its own frame when it finishes.
+  \details Nothing can await or cancel it; whatever it touches must stay
+           alive until it ends, usually through reference counting.
+*/
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+} // namespace sfap
@@ -0,0 +1,38 @@
+/*!
+  \file
+  \brief Executor interface.
+
+  \details
+  Minimal scheduling hook used to resume suspended coroutines on a chosen
+  event loop or thread.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <coroutine>
+
+namespace sfap {
+
+/*!
+  \brief Something that can resume coroutines on its own thread.
+  \details Implemented by proactors. Wakers that run on a different thread
+           than the suspended coroutine hand it over with `post()` instead of
+           resuming it in place.
+*/
+class Executor {
+  public:
+    virtual ~Executor() = default;
+
+    /*!
+      \brief Schedule \p h to be resumed by this executor.
+      \param h Suspended coroutine.
+      \note Thread-safe. May be called from any thread, including the executor's own.
+    */
+    virtual void post(std::coroutine_handle<> h) noexcept = 0;
+};
+
+} // namespace sfap
@@ -0,0 +1,122 @@
+/*!
+  \file
+  \brief String intern pool interface.
+
+  \details
+  Thread-safe pool storing one copy of each distinct string and handing out
+  stable views, so equal strings compare by pointer.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+
+namespace sfap {
+
+/*!
+  \brief Append-only set of strings with stable storage.
+
+  \details Strings are copied once into arena chunks owned by the pool and
+           never move or get freed before the pool is destroyed. Interning an
+           equal string again returns the same view, so two interned views
+           are equal exactly when their `data()` pointers are. Every stored
+           string is followed by a `'\0'`, so `data()` is also a C string.
+
+           The set is split into `shard_count` shards by hash, each with its
+           own lock, arena and open-addressing table of views. Tables and
+           chunks are allocated with `new (std::nothrow)`, so running out of
+           memory fails the call instead of terminating.
+
+  \par Thread-safety
+  All member functions may be called concurrently.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+*/
+class InternPool {
+
+  public:
+    /// \brief Number of independently locked shards.
+    static constexpr std::size_t shard_count{16};
+
+    /// \brief Arena chunk size in bytes; longer strings get a chunk of their own.
+    static constexpr std::size_t chunk_size{4096};
+
+    InternPool() noexcept = default;
+
+    InternPool(InternPool&&) = delete;
+    InternPool(const InternPool&) = delete;
+
+    /// \brief Free all storage. Views handed out become dangling.
+    ~InternPool() noexcept;
+
+    InternPool& operator=(InternPool&&) = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    /// \return Process-wide pool used for hostnames.
+    static InternPool& global() noexcept;
+
+    /*!
+      \brief Find or insert \p text.
+      \return View of the pooled copy, `std::nullopt` on allocation failure.
+      \post The returned view stays valid for the lifetime of the pool.
+    */
+    std::optional<std::string_view> intern(std::string_view text) noexcept;
+
+    /*!
+      \brief Find \p text without inserting it.
+      \return View of the pooled copy, `std::nullopt` if \p text was never interned.
+    */
+    std::optional<std::string_view> find(std::string_view text) const noexcept;
+
+    /// \return Number of distinct strings.
+    std::size_t size() const noexcept;
+
+    /// \return Bytes of string data stored, terminators included.
+    std::size_t bytes() const noexcept;
+
+  private:
+    /// \brief Arena chunk, linked newest first.
+    struct Chunk {
+        Chunk* next;
+        std::size_t used;
+        std::size_t capacity;
+        // Followed by `capacity` bytes of storage.
+    };
+
+    /// \brief Linear-probing table; a slot with a null `data()` is free.
+    struct Shard {
+        mutable std::mutex mutex;
+        std::string_view* slots{};
+        std::size_t capacity{}; ///< Power of two, or `0` before the first insert.
+        std::size_t count{};
+        Chunk* chunks{};
+    };
+
+    /// \return Slot of \p slots holding \p text, or the free slot where it belongs. Requires `capacity > 0`.
+    static std::string_view* slot(std::string_view* slots, std::size_t capacity, std::string_view text,
+                                  std::size_t hash) noexcept;
+
+    /// \brief Make room for one more string in \p shard's table.
+    /// \return `false` on allocation failure; the table is left as it was.
+    static bool reserve(Shard& shard) noexcept;
+
+    /// \return Storage for \p n bytes in \p shard, `nullptr` on allocation failure.
+    static char* allocate(Shard& shard, std::size_t n) noexcept;
+
+    std::array<Shard, shard_count> shards_;
+    std::atomic<std::size_t> size_{};
+    std::atomic<std::size_t> bytes_{};
+};
+
+} // namespace sfap
@@ -0,0 +1,76 @@
+/*!
+  \file
+  \brief Page-backed memory interface.
+
+  \details
+  Anonymous page mappings with huge page, NUMA placement and pre-faulting
+  options for large long-lived buffers.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+
+namespace sfap {
+
+/*!
+  \brief Placement hints for page-backed allocations.
+  \details Default-constructed options give a plain anonymous mapping.
+*/
+struct MemoryOptions {
+
+    /// \brief Page size policy.
+    enum class Pages : std::uint8_t {
+        DEFAULT,          ///< Regular pages.
+        TRANSPARENT_HUGE, ///< Huge-page aligned mapping advised with `MADV_HUGEPAGE`.
+        HUGE,             ///< Explicit `MAP_HUGETLB`; falls back to `TRANSPARENT_HUGE` if none are reserved.
+    };
+
+    Pages pages{Pages::DEFAULT}; ///< Page size policy.
+    int numa_node{-1};           ///< Bind pages to this NUMA node with `mbind`. `-1` leaves placement to the kernel.
+    bool prefault{false};        ///< Fault every page in at allocation so first use does not.
+};
+
+/// \return Default huge page size of the system, or `2 MiB` if it cannot be determined.
+std::size_t huge_page_size() noexcept;
+
+/*!
+  \brief Map anonymous memory according to \p options.
+  \param size Requested bytes. Rounded up to the page size in use
+              (huge page size unless `Pages::DEFAULT`).
+  \param options Placement hints.
+  \return Span over the whole mapping on success. Its size is the rounded size
+          and must be passed back unchanged to `release_pages()`.
+  \note On platforms without `mmap` the memory comes from `operator new` and
+        every option except the size is ignored.
+*/
+sfap::result<std::span<std::byte>> allocate_pages(std::size_t size, const MemoryOptions& options = {}) noexcept;
+
+/*!
+  \brief Grow or shrink a mapping from `allocate_pages()`.
+  \param pages Span exactly as returned by `allocate_pages()` or `resize_pages()` with
+               `Pages::DEFAULT`. Empty span allocates a new mapping.
+  \param size New size in bytes, rounded up to the page size.
+  \return Span over the resized mapping. Contents up to the smaller size are kept and
+          \p pages is no longer valid. On failure \p pages is left untouched.
+  \details On Linux this is `mremap` with `MREMAP_MAYMOVE`: the kernel extends the
+           mapping in place or moves its page table entries, never copying bytes.
+*/
+sfap::result<std::span<std::byte>> resize_pages(std::span<std::byte> pages, std::size_t size) noexcept;
+
+/*!
+  \brief Release memory obtained from `allocate_pages()`.
+  \param pages Span exactly as returned by `allocate_pages()`. Empty span is a no-op.
+*/
+void release_pages(std::span<std::byte> pages) noexcept;
+
+} // namespace sfap
@@ -0,0 +1,176 @@
+/*!
+  \file
+  \brief Multi-producer record ring buffer interface.
+
+  \details
+  Bounded lock-free queues of variable-length byte records for fan-in
+  (MPSC) and work distribution (MPMC), using the same zero-copy
+  {prepare,commit}_{write,read} pattern as `RingBuffer`.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sfap {
+
+/*!
+  \brief Bounded lock-free ring of variable-length byte records.
+
+  \tparam MultiConsumer `false` for a single consumer (MPSC), `true` for
+          any number of consumers (MPMC).
+
+  \details Storage is split into blocks of `block_size` bytes. A record
+           occupies consecutive blocks and is never split across the wrap
+           point; the tail of the ring is skipped with an internal padding
+           record instead. Every block has a slot holding a sequence tag
+           (absolute block position plus state) and the record length, kept
+           outside the payload so record bytes can never be mistaken for
+           metadata.
+
+  \invariant Capacity is a power of two and a multiple of `block_size`.
+
+  \par Thread-safety
+  - `prepare_write()`/`commit_write()` may be called from any number of threads.
+  - `prepare_read()`/`commit_read()` from one thread (MPSC) or any number of threads (MPMC).
+  - Lock-free: reservations and claims are single CAS loops. No dynamic allocation after construction.
+
+  \par Ordering
+  Records are read in reservation order. A reserved but not yet committed
+  record blocks readers behind it until it is committed.
+
+  \par Exceptions
+  All functions are `noexcept`. No exceptions are thrown.
+ */
+template <bool MultiConsumer> class MpRingBuffer {
+
+  public:
+    /// \brief Allocation granularity of records in bytes.
+    static constexpr std::size_t block_size{64};
+
+    /// \brief Assumed cache line size used to keep producer and consumer state apart.
+    static constexpr std::size_t cache_line_size{64};
+
+    /*!
+      \brief Construct an owning ring with capacity `n`.
+      \param n Capacity in bytes. Must be a power of two and at least `block_size`.
+      \warning On invalid `n` or allocation failure the object is invalid and
+               `operator bool()` returns `false`.
+     */
+    explicit MpRingBuffer(std::size_t n) noexcept;
+
+    /// \brief Not movable: producers and consumers hold positions into the ring.
+    MpRingBuffer(MpRingBuffer&&) = delete;
+    MpRingBuffer(const MpRingBuffer&) = delete;
+    ~MpRingBuffer() noexcept;
+
+    MpRingBuffer& operator=(MpRingBuffer&&) = delete;
+    MpRingBuffer& operator=(const MpRingBuffer&) = delete;
+
+    /*!
+      \brief Validity check.
+      \return `true` if the instance is properly initialized.
+     */
+    explicit operator bool() const noexcept;
+
+    /// \return Fixed capacity in bytes. Also the largest record that can ever be reserved.
+    std::size_t capacity() const noexcept;
+
+    /*!
+      \return Bytes reserved by producers and not yet released by consumers,
+              rounded up to blocks and including padding.
+      \note Approximate while other threads are active.
+     */
+    std::size_t size() const noexcept;
+
+    /// \return `true` if `size() == 0`.
+    bool empty() const noexcept;
+
+    /*!
+      \brief Reserved record handed out by `prepare_write()`/`prepare_read()`.
+      \details Evaluates to `false` when nothing could be reserved or claimed.
+     */
+    template <class Byte> struct Record {
+        std::span<Byte> data;       ///< Record payload.
+        std::uint64_t position{};   ///< Absolute block position, identifies the record on commit.
+
+        explicit operator bool() const noexcept {
+            return data.data() != nullptr;
+        }
+    };
+
+    /// \brief Writable record for producers.
+    using WriteRecord = Record<std::byte>;
+
+    /// \brief Readable record for consumers.
+    using ReadRecord = Record<const std::byte>;
+
+    /*!
+      \brief Reserve a contiguous record of exactly `n` bytes.
+      \param n Record length in bytes, `1..capacity()`.
+      \return Record to fill, or an empty record if the ring has no room.
+      \post Call `commit_write()` with the returned record to publish it.
+     */
+    WriteRecord prepare_write(std::size_t n) noexcept;
+
+    /*!
+      \brief Publish a record previously reserved with `prepare_write()`.
+      \param record Record returned by `prepare_write()`.
+      \return `false` if \p record is empty.
+     */
+    bool commit_write(const WriteRecord& record) noexcept;
+
+    /*!
+      \brief Claim the oldest committed record.
+      \return Record to read, or an empty record if the oldest one is missing or not committed yet.
+      \post Call `commit_read()` with the returned record to release its space.
+     */
+    ReadRecord prepare_read() noexcept;
+
+    /*!
+      \brief Release a record previously claimed with `prepare_read()`.
+      \param record Record returned by `prepare_read()`.
+      \return `false` if \p record is empty.
+      \details Records may be released in any order; space is returned to
+               producers once every older record has been released too.
+     */
+    bool commit_read(const ReadRecord& record) noexcept;
+
+  private:
+    /// \brief Per-block metadata.
+    struct Slot {
+        std::atomic<std::uint64_t> tag{};  ///< `(position << 2) | state` of the record starting here.
+        std::atomic<std::size_t> length{}; ///< Record length in bytes.
+    };
+
+    void release(std::uint64_t position) noexcept;
+
+    std::byte* data_{};      ///< Record storage.
+    Slot* slots_{};          ///< One slot per block.
+    std::size_t capacity_{}; ///< Capacity in bytes (power of two).
+    std::uint64_t blocks_{}; ///< `capacity_ / block_size`.
+    std::uint64_t mask_{};   ///< `blocks_ - 1` for slot wrap.
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> head_{}; ///< Next block to reserve.
+    alignas(cache_line_size) std::atomic<std::uint64_t> read_{}; ///< Next block to claim.
+    alignas(cache_line_size) std::atomic<std::uint64_t> tail_{}; ///< First block not yet released.
+};
+
+/// \brief Many producers, one consumer. Fan-in for loggers, exporters and writers.
+using MpscRingBuffer = MpRingBuffer<false>;
+
+/// \brief Many producers, many consumers. Bounded work queue.
+using MpmcRingBuffer = MpRingBuffer<true>;
+
+extern template class MpRingBuffer<false>;
+extern template class MpRingBuffer<true>;
+
+} // namespace sfap
@@ -14,10 +14,15 @@
 #pragma once
 
 #include <atomic>
+#include <coroutine>
 #include <span>
 #include <utility>
 
 #include <cstddef>
+#include <cstdint>
+
+#include <sfap/utils/executor.hpp>
+#include <sfap/utils/memory.hpp>
 
 namespace sfap {
 
@@ -32,6 +37,20 @@ namespace sfap {
   - Not safe for multiple producers or multiple consumers.
   - No blocking. No dynamic allocation in steady state.
 
+  \par Layout
+  Producer and consumer state live on separate cache lines. Each side keeps a
+  private copy of the opposite index and reloads the shared atomic only when
+  the copy reports the buffer as full (producer) or empty (consumer).
+
+  \par Waiting
+  `readable()`/`writable()` return awaitables that suspend the calling
+  coroutine until the other side commits enough bytes or space. At most one
+  reader and one writer may wait at a time. Once a ring has been awaited,
+  commits pay one sequentially consistent fence so a registering waiter is
+  never missed. Before that they pay nothing: the first waiter runs
+  `membarrier()` to order both sides instead. Where that is unavailable,
+  every ring fences from the start.
+
   \par Exceptions
   All functions are `noexcept`. No exceptions are thrown.
 
@@ -51,6 +70,15 @@ class RingBuffer {
      */
     explicit RingBuffer(std::size_t n) noexcept;
 
+    /*!
+      \brief Construct an owning buffer backed by a page mapping.
+      \param n Minimum capacity in bytes. Must be a power of two.
+      \param options Huge page, NUMA and pre-fault hints, see `allocate_pages()`.
+      \post `capacity()` is `n` rounded up to the page size in use, still a power of two.
+      \warning On invalid `n` or mapping failure `operator bool()` returns `false`.
+     */
+    RingBuffer(std::size_t n, const MemoryOptions& options) noexcept;
+
     /*!
       \brief Construct a non-owning buffer over external storage.
       \param external Backing memory. Size must be a power of two.
@@ -59,7 +87,10 @@ class RingBuffer {
      */
     explicit RingBuffer(std::span<std::byte> external) noexcept;
 
-    /// \brief Move-construct, transferring ownership if any.
+    /*!
+      \brief Move-construct, transferring ownership if any.
+      \warning Waiters are not transferred. Do not move while a coroutine is suspended on the buffer.
+     */
     RingBuffer(RingBuffer&&) noexcept;
 
     RingBuffer(const RingBuffer&) = delete;
@@ -166,17 +197,84 @@ class RingBuffer {
      */
     static std::size_t view_size(View<const std::byte> view) noexcept;
 
+    class Awaiter;
+
+    /*!
+      \brief Await until at least `n` bytes are readable.
+      \param n Bytes required. Clamped to `capacity()`.
+      \param executor Executor that resumes the coroutine, e.g. the consumer's
+                      proactor. `nullptr` resumes it inline inside the producer's commit.
+      \return Awaitable yielding `size()` after wake-up.
+      \pre Consumer-only. No other reader waiting.
+     */
+    Awaiter readable(std::size_t n, Executor* executor = nullptr) noexcept;
+
+    /*!
+      \brief Await until at least `n` bytes are writable.
+      \param n Bytes required. Clamped to `capacity()`.
+      \param executor Executor that resumes the coroutine, e.g. the producer's
+                      proactor. `nullptr` resumes it inline inside the consumer's commit.
+      \return Awaitable yielding `free()` after wake-up.
+      \pre Producer-only. No other writer waiting.
+     */
+    Awaiter writable(std::size_t n, Executor* executor = nullptr) noexcept;
+
+    /// \brief Awaitable returned by `readable()`/`writable()`.
+    class Awaiter {
+      public:
+        bool await_ready() const noexcept;
+        bool await_suspend(std::coroutine_handle<> h) noexcept;
+        std::size_t await_resume() const noexcept;
+
+      private:
+        friend class RingBuffer;
+
+        Awaiter(RingBuffer& ring, bool read, std::size_t n, Executor* executor) noexcept;
+
+        bool satisfied() const noexcept;
+
+        RingBuffer& ring_;
+        bool read_;
+        std::size_t needed_;
+        Executor* executor_;
+        std::coroutine_handle<> handle_{};
+    };
+
+    /// \brief Assumed cache line size used to keep producer and consumer state apart.
+    static constexpr std::size_t cache_line_size{64};
+
   private:
-    std::byte* data_{};      ///< Base pointer.
-    std::size_t capacity_{}; ///< Capacity in bytes (power of two).
-    bool is_owner_{};        ///< Owns `data_` and frees on destruction.
+    /// \brief Origin of `data_`, decides how it is released.
+    enum class Storage : std::uint8_t {
+        EXTERNAL, ///< Not owned.
+        HEAP,     ///< `new[]`.
+        PAGES,    ///< `allocate_pages()`.
+    };
+
+    /// \brief Resume the awaiter parked in \p slot if its condition now holds.
+    void wake(std::atomic<Awaiter*>& slot) noexcept;
 
-    std::size_t mask_{};              ///< `capacity_ - 1` for index wrap.
-    std::atomic<std::size_t> head_{}; ///< Producer index (next write).
-    std::atomic<std::size_t> tail_{}; ///< Consumer index (next read).
+    /// \return `true` if the process can use `membarrier()` as the heavy side of an asymmetric fence.
+    static bool asymmetric_fence() noexcept;
 
-    std::size_t pending_w_{}; ///< Bytes prepared for write not committed.
-    std::size_t pending_r_{}; ///< Bytes prepared for read not committed.
+    /// \brief Free owned storage, if any.
+    void release() noexcept;
+
+    std::byte* data_{};      ///< Base pointer.
+    std::size_t capacity_{}; ///< Capacity in bytes (power of two).
+    Storage storage_{};      ///< Owns `data_` unless `EXTERNAL`.
+    std::size_t mask_{};     ///< `capacity_ - 1` for index wrap.
+    std::atomic<bool> awaited_{!asymmetric_fence()}; ///< Commits fence before checking for waiters.
+
+    alignas(cache_line_size) std::atomic<std::size_t> head_{}; ///< Producer index (next write).
+    std::size_t tail_cache_{};              ///< Producer copy of `tail_`, refreshed when it reports full.
+    std::size_t pending_w_{};               ///< Bytes prepared for write not committed.
+    std::atomic<Awaiter*> write_waiter_{}; ///< Producer parked in `writable()`.
+
+    alignas(cache_line_size) std::atomic<std::size_t> tail_{}; ///< Consumer index (next read).
+    std::size_t head_cache_{};             ///< Consumer copy of `head_`, refreshed when it reports empty.
+    std::size_t pending_r_{};              ///< Bytes prepared for read not committed.
+    std::atomic<Awaiter*> read_waiter_{}; ///< Consumer parked in `readable()`.
 };
 
 } // namespace sfap
\ No newline at end of file
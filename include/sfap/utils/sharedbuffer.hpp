@@ -0,0 +1,152 @@
+/*!
+  \file
+  \brief Shared buffer interface.
+
+  \details
+  Immutable, atomically reference-counted byte buffer and slices over it for
+  sending the same bytes to many peers without copying.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include <cstddef>
+
+#include <sfap/utils/buffer.hpp>
+
+namespace sfap {
+
+class BufferSlice;
+
+/*!
+  \brief Immutable byte buffer shared by reference count.
+  \details Takes over a filled `Buffer`; its used bytes become read-only and
+           are released with the last `SharedBuffer` or `BufferSlice`
+           referring to them. Copies share the bytes.
+
+  \par Thread-safety
+  Distinct instances referring to the same bytes may be copied and destroyed
+  concurrently. One instance is not safe for concurrent modification.
+*/
+class SharedBuffer {
+
+  public:
+    /// \brief Construct null buffer.
+    SharedBuffer() noexcept = default;
+
+    /*!
+      \brief Take over \p buffer.
+      \param buffer Filled buffer. Its `size()` bytes are shared; spare capacity is unused.
+      \note On allocation failure or null \p buffer the result is null and \p buffer is left untouched,
+            so the caller still owns it.
+    */
+    explicit SharedBuffer(Buffer&& buffer) noexcept;
+
+    /*!
+      \brief Allocate a buffer holding a copy of \p bytes.
+      \return Shared buffer, null on allocation failure or empty \p bytes.
+    */
+    static SharedBuffer copy_of(std::span<const std::byte> bytes) noexcept;
+
+    /// \brief Share the bytes of \p other.
+    SharedBuffer(const SharedBuffer& other) noexcept;
+
+    /// \brief Move construct. Source becomes null.
+    SharedBuffer(SharedBuffer&& other) noexcept;
+
+    /// \brief Drop one reference; the last one frees the bytes.
+    ~SharedBuffer() noexcept;
+
+    SharedBuffer& operator=(const SharedBuffer& other) noexcept;
+    SharedBuffer& operator=(SharedBuffer&& other) noexcept;
+
+    /*!
+      \brief Validity check.
+      \return `true` if the instance refers to bytes.
+     */
+    explicit operator bool() const noexcept;
+
+    /// \return Number of shared bytes.
+    std::size_t size() const noexcept;
+
+    /// \return data pointer or `nullptr`.
+    const std::byte* data() const noexcept;
+
+    /// \return span over all shared bytes, empty for null buffer.
+    std::span<const std::byte> view() const noexcept;
+
+    /// \return Number of `SharedBuffer` and `BufferSlice` instances referring to the bytes, `0` for null buffer.
+    std::size_t use_count() const noexcept;
+
+    /*!
+      \brief Create a slice holding a reference.
+      \param from Start index within `[0, size()]`.
+      \param count Number of bytes in the slice.
+      \return Slice on success; `std::nullopt` if buffer is null or the range exceeds `size()`.
+    */
+    std::optional<BufferSlice> slice(std::size_t from, std::size_t count) const noexcept;
+
+  private:
+    /// \brief Heap block holding the count and the bytes.
+    struct Block;
+
+    Block* block_{};
+};
+
+/*!
+  \brief Offset/length view into a `SharedBuffer` that keeps the bytes alive.
+  \details Cheap to copy: one atomic increment. Passing a slice by value into
+           a coroutine keeps the bytes alive until the coroutine finishes.
+*/
+class BufferSlice {
+
+  public:
+    /// \brief Construct empty slice.
+    BufferSlice() noexcept = default;
+
+    /// \brief Slice over all bytes of \p buffer.
+    explicit BufferSlice(SharedBuffer buffer) noexcept;
+
+    /// \return `true` if the slice refers to a buffer.
+    explicit operator bool() const noexcept;
+
+    /// \return Number of bytes in the slice.
+    std::size_t size() const noexcept;
+
+    /// \return `true` if `size() == 0`.
+    bool empty() const noexcept;
+
+    /// \return data pointer or `nullptr`.
+    const std::byte* data() const noexcept;
+
+    /// \return span over the slice.
+    std::span<const std::byte> view() const noexcept;
+
+    /// \return Buffer the slice refers to.
+    const SharedBuffer& buffer() const noexcept;
+
+    /*!
+      \brief Narrow the slice.
+      \param from Start index within `[0, size()]`.
+      \param count Number of bytes.
+      \return Slice sharing the same buffer, `std::nullopt` if the range exceeds `size()`.
+    */
+    std::optional<BufferSlice> subslice(std::size_t from, std::size_t count) const noexcept;
+
+  private:
+    friend class SharedBuffer;
+
+    BufferSlice(SharedBuffer buffer, std::size_t offset, std::size_t length) noexcept;
+
+    SharedBuffer buffer_{};
+    std::size_t offset_{};
+    std::size_t length_{};
+};
+
+} // namespace sfap
@@ -12,27 +12,36 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
 #include <string_view>
 
 #include <cstddef>
 
-#include <sfap/utils/buffer.hpp>
-
 namespace sfap {
 
 /*!
   \brief Lightweight owning, null-terminated string container.
 
-  \details Holds an internal byte buffer with a trailing `'\0'`.
+  \details Holds `size() + 1` bytes with a trailing `'\0'`.
            Invariant: if the object evaluates to true (`operator bool`), then
-           `data_.size() == size() + 1` and `c_str()[size()] == '\0'`.
+           `c_str()[size()] == '\0'`.
            An empty instance has `size() == 0` and `c_str() == ""`.
 
+           Strings of up to `inline_capacity` characters are stored inside
+           the object, so short strings such as hostnames never allocate.
+           Longer strings live in a heap block whose pointer and capacity
+           share that space, which keeps the object 32 bytes on 64-bit
+           targets.
+
   \note This class only deals with raw bytes (ASCII/UTF-8 safe). No encoding normalization.
 */
 class String {
 
   public:
+    /// \brief Longest string stored without a heap allocation.
+    static constexpr std::size_t inline_capacity{2 * sizeof(void*) + sizeof(std::size_t) - 1};
+
     /*!
       \brief Constructs from a `std::string_view`.
       \param source Source view. May contain embedded null characters.
@@ -57,20 +66,21 @@ class String {
     String(const String&) noexcept;
 
     /*!
-      \brief Constructs from a C-string pointer.
-      \param source Pointer to a null-terminated string. May be `nullptr`.
-
-      \details If `source == nullptr`, creates an empty string (`size() == 0`, `c_str() == ""`).
-               Otherwise copies `strlen(source) + 1` bytes including the null terminator.
+      \brief Constructs an empty string with room for \p n characters.
+      \param n Capacity excluding the null terminator.
+      \post `capacity()` is `max(n, inline_capacity)`.
     */
     explicit String(std::size_t n) noexcept;
 
-    ~String() noexcept = default;
+    ~String() noexcept;
 
     String& operator=(const String&) = delete;
 
-    String(String&&) noexcept = default;
-    String& operator=(String&&) noexcept = default;
+    /// \brief Move construct. Inline contents are copied, heap buffers are taken over. Source becomes null.
+    String(String&& other) noexcept;
+
+    /// \brief Move assign. Inline contents are copied, heap buffers are taken over. Source becomes null.
+    String& operator=(String&& other) noexcept;
 
     /// \brief Checks if the instance owns a valid buffer.
     explicit operator bool() const noexcept;
@@ -191,7 +201,21 @@ class String {
     std::optional<std::string_view> subview(std::size_t from, std::size_t count = 0) const noexcept;
 
   private:
-    Buffer data_; ///< Underlying byte buffer (`size() + 1` bytes, last is `'\0'`).
+    /// \brief Heap block of a string longer than `inline_capacity`.
+    struct Heap {
+        char* data;           ///< `capacity + 1` bytes, `nullptr` for a null string.
+        std::size_t capacity; ///< Characters, excluding the NUL.
+    };
+
+    /// \brief Make `*this` a null string. Does not free the heap block.
+    void reset() noexcept;
+
+    union {
+        std::array<char, inline_capacity + 1> inline_; ///< Storage for short strings.
+        Heap heap_;                                    ///< Storage for long strings.
+    };
+    std::size_t size_ : sizeof(std::size_t) * 8 - 1; ///< Characters, excluding the NUL.
+    std::size_t on_heap_ : 1;                        ///< `heap_` is active rather than `inline_`.
 };
 
 } // namespace sfap
\ No newline at end of file
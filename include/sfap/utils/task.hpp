@@ -1,3 +1,22 @@
+/*!
+  \file
+  \brief Lazily started coroutine task.
+
+  \details
+  Awaiting a task resumes it through symmetric transfer, so chains of awaits
+  that complete synchronously run in constant stack.
+
+  \note On GCC that only holds when sibling-call optimisation is enabled,
+        which -O0 turns off. Targets linking the `sfap` CMake target get
+        `-foptimize-sibling-calls` automatically; other builds that include
+        this header must pass it themselves. AddressSanitizer builds do not
+        get tail calls even with the flag.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
 #pragma once
 
 #include <coroutine>
@@ -52,9 +71,12 @@ template <typename T> class task {
                 return !h || h.done();
             }
 
-            void await_suspend(std::coroutine_handle<> cont) noexcept {
+            // Symmetric transfer: the awaiting coroutine jumps into `h`
+            // instead of calling it, so chains of awaits that complete
+            // synchronously run in constant stack.
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> cont) noexcept {
                 h.promise().continuation = cont;
-                h.resume();
+                return h;
             }
 
             T await_resume() noexcept {
@@ -89,11 +111,12 @@ template <typename T> class task {
                     return false;
                 }
 
-                void await_suspend(handle_type h) noexcept {
+                std::coroutine_handle<> await_suspend(handle_type h) noexcept {
                     auto cont = h.promise().continuation;
                     if (cont) {
-                        cont.resume();
+                        return cont;
                     }
+                    return std::noop_coroutine();
                 }
 
                 void await_resume() noexcept {}
@@ -162,9 +185,9 @@ template <> class task<void> {
                 return !h || h.done();
             }
 
-            void await_suspend(std::coroutine_handle<> cont) noexcept {
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> cont) noexcept {
                 h.promise().continuation = cont;
-                h.resume();
+                return h;
             }
 
             void await_resume() noexcept {}
@@ -196,11 +219,12 @@ template <> class task<void> {
                     return false;
                 }
 
-                void await_suspend(handle_type h) noexcept {
+                std::coroutine_handle<> await_suspend(handle_type h) noexcept {
                     auto cont = h.promise().continuation;
                     if (cont) {
-                        cont.resume();
+                        return cont;
                     }
+                    return std::noop_coroutine();
                 }
 
                 void await_resume() noexcept {}
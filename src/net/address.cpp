@@ -18,15 +18,9 @@
 #include <sfap/net/address_kind.hpp>
 #include <sfap/net/resolve.hpp>
 #include <sfap/net/types.hpp>
+#include <sfap/utils/intern.hpp>
 #include <sfap/utils/string.hpp>
 
-sfap::net::Address::Address() noexcept : address_(std::nullopt), origin_(std::nullopt) {}
-
-sfap::net::Address::Address(const ipx_t& ip, port_t port) noexcept : origin_(std::nullopt) {
-    from_ip(ip);
-    set_port(port);
-}
-
 sfap::net::Address::Address(const String& hostname, port_t port) noexcept {
     from_hostname(hostname);
     set_port(port);
@@ -43,6 +37,7 @@ void sfap::net::Address::from_ip(const ipx_t& ip) noexcept {
         address_->ip_ = ip;
     else
         address_ = {ip, 0};
+    update_socket_address();
 }
 
 sfap::error_code sfap::net::Address::from_hostname(const String& hostname) noexcept {
@@ -60,44 +55,33 @@ sfap::error_code sfap::net::Address::from_hostname(const char* hostname) noexcep
     if (!result)
         return result.error();
 
-    origin_.reset();
+    std::optional<std::string_view> origin;
+    if (type == AddressKind::HOSTNAME) {
+        origin = InternPool::global().intern(hostname);
+        if (!origin)
+            return generic_error(errc::NOT_ENOUGH_MEMORY).error();
+    }
+
+    origin_ = origin;
 
     if (address_)
         address_->ip_ = *result;
     else
         address_ = {*result, 0};
-
-    if (type == AddressKind::HOSTNAME)
-        origin_ = String(hostname);
+    update_socket_address();
 
     return sfap::no_error();
 }
 
 void sfap::net::Address::set_port(port_t port) noexcept {
-    if (address_)
-        address_->port_ = port;
-}
-
-const std::optional<sfap::net::Address::InternalAddress>& sfap::net::Address::get_address() const noexcept {
-    return address_;
-}
-
-std::optional<std::string_view> sfap::net::Address::get_origin() const noexcept {
-    if (!origin_)
-        return std::nullopt;
-    return origin_->view();
-}
-
-sfap::net::Address::operator bool() const noexcept {
-    return address_.has_value();
-}
-
-bool sfap::net::Address::is_bindable() const noexcept {
-    return address_.has_value();
+    if (!address_)
+        return;
+    address_->port_ = port;
+    update_socket_address();
 }
 
-bool sfap::net::Address::is_connectable() const noexcept {
-    return address_.has_value() && !ipx_t::is_any(address_->ip_) && address_->port_ != 0;
+bool sfap::net::Address::same_origin(const Address& other) const noexcept {
+    return origin_ && other.origin_ && origin_->data() == other.origin_->data();
 }
 
 void sfap::net::Address::clear() noexcept {
@@ -13,91 +13,78 @@
 #include <array>
 #include <string_view>
 
-#include <cctype>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
-#if defined(_WIN32)
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#else
-#include <arpa/inet.h>
-#include <netinet/in.h>
-#endif
-
 #include <sfap/error.hpp>
 #include <sfap/net/address_kind.hpp>
+#include <sfap/net/parse_ip.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/string.hpp>
 
 namespace {
 
-const auto is_alpha = [](unsigned char c) noexcept -> bool { return std::isalpha(c); };
-const auto is_alnum_hyph = [](unsigned char c) noexcept -> bool { return std::isalnum(c) || c == '-'; };
+/// \brief Character classes of `label_class`.
+enum : std::uint8_t {
+    LABEL = 1 << 0, ///< Allowed inside a label: ASCII letter, digit or '-'.
+    ALPHA = 1 << 1, ///< ASCII letter, the only class allowed in a non-IDN TLD.
+};
+
+/// \brief Class bits of every byte; `'.'` and everything else not listed is 0.
+constexpr std::array<std::uint8_t, 256> label_class = [] {
+    std::array<std::uint8_t, 256> table{};
+    for (int c = '0'; c <= '9'; ++c)
+        table[c] = LABEL;
+    for (int c = 'a'; c <= 'z'; ++c)
+        table[c] = LABEL | ALPHA;
+    for (int c = 'A'; c <= 'Z'; ++c)
+        table[c] = LABEL | ALPHA;
+    table['-'] = LABEL;
+    return table;
+}();
 
-const auto is_fqdn = [](std::string_view s) noexcept -> bool {
+/*!
+  \brief Validates \p s as a hostname in one pass.
+  \details Labels are 1-63 bytes of letters, digits and '-' without a leading
+           or trailing '-'. Without a trailing dot the last label is the TLD
+           and must be either all letters (2+) or an "xn--" IDN label.
+*/
+bool is_fqdn(std::string_view s) noexcept {
     if (s.empty())
         return false;
 
     const bool trailing_dot = s.back() == '.';
-    if ((!trailing_dot && s.size() > 253) || (trailing_dot && s.size() > 254))
+    if (s.size() > (trailing_dot ? 254u : 253u))
         return false;
 
-    std::size_t label_start = 0;
-    std::size_t label_len = 0;
-    int labels = 0;
+    const std::size_t end{trailing_dot ? s.size() - 1 : s.size()};
+    std::size_t label_start{};
+    std::uint8_t label_bits{LABEL | ALPHA}; // AND of the classes of the current label
 
-    auto check_label = [&](std::size_t start, std::size_t len) -> bool {
-        if (len == 0 || len > 63)
-            return false;
-        if (s[start] == '-' || s[start + len - 1] == '-')
-            return false;
-        for (std::size_t i = 0; i < len; ++i)
-            if (!is_alnum_hyph((unsigned char)s[start + i]))
-                return false;
-        return true;
-    };
-
-    for (std::size_t i = 0; i < s.size(); ++i) {
-        if (s[i] == '.') {
-            if (!check_label(label_start, label_len))
-                return false;
-            ++labels;
-            label_start = i + 1;
-            label_len = 0;
-        } else {
-            ++label_len;
+    for (std::size_t i = 0; i <= end; ++i) {
+        if (i < end && s[i] != '.') {
+            label_bits &= label_class[static_cast<unsigned char>(s[i])];
+            continue;
         }
-    }
-
-    if (trailing_dot)
-        return labels >= 1;
 
-    if (!check_label(label_start, label_len))
-        return false;
-    ++labels;
+        const std::size_t len{i - label_start};
+        if (len == 0 || len > 63 || !(label_bits & LABEL) || s[label_start] == '-' || s[i - 1] == '-')
+            return false;
 
-    if (labels < 1)
-        return false;
+        if (i == end && !trailing_dot) {
+            const std::string_view tld{s.substr(label_start, len)};
+            if (tld.starts_with("xn--"))
+                return tld.size() >= 5;
+            return tld.size() >= 2 && (label_bits & ALPHA);
+        }
 
-    std::string_view tld = s.substr(label_start, label_len);
-    const bool puny = tld.rfind("xn--", 0) == 0;
-    if (puny) {
-        if (tld.size() < 5 || tld.size() > 63)
-            return false; // "xn--" + 1..59
-        for (std::size_t i = 4; i < tld.size(); ++i)
-            if (!is_alnum_hyph((unsigned char)tld[i]))
-                return false;
-    } else {
-        if (tld.size() < 2 || tld.size() > 63)
-            return false;
-        for (unsigned char c : tld)
-            if (!is_alpha(c))
-                return false;
+        label_start = i + 1;
+        label_bits = LABEL | ALPHA;
     }
 
     return true;
-};
+}
 
 } // namespace
 
@@ -116,21 +103,12 @@ sfap::result<sfap::net::AddressKind> sfap::net::detect_address_kind(const char*
     if (address_size > 254)
         return AddressKind::UNKNOWN;
 
-    alignas(in6_addr) std::array<std::byte, sizeof(in6_addr)> sink;
-
-    const int ip4_test_result = ::inet_pton(AF_INET, address, sink.data());
-    if (ip4_test_result == 1)
-        return AddressKind::IP4;
-    else if (ip4_test_result == -1)
-        return sfap::network_error();
+    const std::string_view text{address, address_size};
 
-    const int ip6_test_result = ::inet_pton(AF_INET6, address, sink.data());
-    if (ip6_test_result == 1)
-        return AddressKind::IP6;
-    else if (ip6_test_result == -1)
-        return sfap::network_error();
+    if (auto ip = parse_ip(text))
+        return ip->is_4() ? AddressKind::IP4 : AddressKind::IP6;
 
-    if (is_fqdn({address, address_size}))
+    if (is_fqdn(text))
         return AddressKind::HOSTNAME;
 
     return net::AddressKind::UNKNOWN;
@@ -0,0 +1,99 @@
+/*!
+  \file
+  \brief Resolved address list implementation.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <new>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/types.hpp>
+
+sfap::net::AddressList::~AddressList() noexcept {
+    delete[] heap_;
+}
+
+sfap::net::AddressList::AddressList(AddressList&& other) noexcept
+    : heap_(std::exchange(other.heap_, nullptr)), size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, inline_capacity)) {
+    if (!heap_)
+        std::copy_n(other.inline_.begin(), size_, inline_.begin());
+}
+
+sfap::net::AddressList& sfap::net::AddressList::operator=(AddressList&& other) noexcept {
+    if (this != &other) {
+        delete[] heap_;
+        heap_ = std::exchange(other.heap_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, inline_capacity);
+        if (!heap_)
+            std::copy_n(other.inline_.begin(), size_, inline_.begin());
+    }
+    return *this;
+}
+
+bool sfap::net::AddressList::push_back(const ipx_t& ip) noexcept {
+    if (size_ == capacity_) {
+        auto* grown{new (std::nothrow) ipx_t[capacity_ * 2]};
+        if (!grown)
+            return false;
+        std::copy_n(storage(), size_, grown);
+        delete[] heap_;
+        heap_ = grown;
+        capacity_ *= 2;
+    }
+    storage()[size_++] = ip;
+    return true;
+}
+
+bool sfap::net::AddressList::contains(const ipx_t& ip) const noexcept {
+    return std::find(begin(), end(), ip) != end();
+}
+
+void sfap::net::AddressList::clear() noexcept {
+    size_ = 0;
+}
+
+std::size_t sfap::net::AddressList::size() const noexcept {
+    return size_;
+}
+
+std::size_t sfap::net::AddressList::capacity() const noexcept {
+    return capacity_;
+}
+
+bool sfap::net::AddressList::empty() const noexcept {
+    return size_ == 0;
+}
+
+const sfap::net::ipx_t* sfap::net::AddressList::data() const noexcept {
+    return heap_ ? heap_ : inline_.data();
+}
+
+const sfap::net::ipx_t& sfap::net::AddressList::operator[](std::size_t i) const noexcept {
+    return data()[i];
+}
+
+const sfap::net::ipx_t* sfap::net::AddressList::begin() const noexcept {
+    return data();
+}
+
+const sfap::net::ipx_t* sfap::net::AddressList::end() const noexcept {
+    return data() + size_;
+}
+
+sfap::net::AddressList::operator std::span<const ipx_t>() const noexcept {
+    return {data(), size_};
+}
+
+sfap::net::ipx_t* sfap::net::AddressList::storage() noexcept {
+    return heap_ ? heap_ : inline_.data();
+}
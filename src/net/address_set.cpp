@@ -0,0 +1,163 @@
+/*!
+  \file
+  \brief Client-side load balancing implementation.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <random>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/net/address.hpp>
+#include <sfap/net/address_set.hpp>
+#include <sfap/net/types.hpp>
+
+namespace {
+
+/// \brief Per-thread xorshift generator; quality is ample for picking replicas.
+std::uint64_t next_random() noexcept {
+    thread_local std::uint64_t state{std::random_device{}() | 1};
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/// \brief Uniform index below \p n without division (Lemire's multiply-shift).
+std::size_t random_below(std::size_t n) noexcept {
+    __extension__ using u128 = unsigned __int128;
+    return static_cast<std::size_t>((static_cast<u128>(next_random()) * n) >> 64);
+}
+
+} // namespace
+
+sfap::net::AddressSet::Lease::Lease(Slot* slot, std::size_t index) noexcept : slot_(slot), index_(index) {
+    slot_->outstanding.fetch_add(1, std::memory_order_relaxed);
+}
+
+sfap::net::AddressSet::Lease::~Lease() noexcept {
+    release();
+}
+
+sfap::net::AddressSet::Lease::Lease(Lease&& other) noexcept
+    : slot_(std::exchange(other.slot_, nullptr)), index_(other.index_) {}
+
+sfap::net::AddressSet::Lease& sfap::net::AddressSet::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        slot_ = std::exchange(other.slot_, nullptr);
+        index_ = other.index_;
+    }
+    return *this;
+}
+
+sfap::net::AddressSet::Lease::operator bool() const noexcept {
+    return slot_ != nullptr;
+}
+
+const sfap::net::Address& sfap::net::AddressSet::Lease::address() const noexcept {
+    return slot_->address;
+}
+
+std::size_t sfap::net::AddressSet::Lease::index() const noexcept {
+    return index_;
+}
+
+void sfap::net::AddressSet::Lease::release() noexcept {
+    if (slot_)
+        std::exchange(slot_, nullptr)->outstanding.fetch_sub(1, std::memory_order_relaxed);
+}
+
+sfap::net::AddressSet::AddressSet(std::span<const ipx_t> ips, port_t port, BalancePolicy policy) noexcept
+    : policy_(policy) {
+    if (ips.empty())
+        return;
+
+    slots_.reset(new (std::nothrow) Slot[ips.size()]);
+    if (!slots_)
+        return;
+    for (const ipx_t& ip : ips)
+        slots_[size_++].address = Address{ip, port};
+}
+
+sfap::net::AddressSet::AddressSet(std::span<const Address> addresses, BalancePolicy policy) noexcept
+    : policy_(policy) {
+    if (addresses.empty())
+        return;
+
+    slots_.reset(new (std::nothrow) Slot[addresses.size()]);
+    if (!slots_)
+        return;
+    for (const Address& address : addresses)
+        if (address)
+            slots_[size_++].address = address;
+}
+
+sfap::net::AddressSet::operator bool() const noexcept {
+    return size_ != 0;
+}
+
+std::size_t sfap::net::AddressSet::size() const noexcept {
+    return size_;
+}
+
+sfap::net::BalancePolicy sfap::net::AddressSet::policy() const noexcept {
+    return policy_;
+}
+
+const sfap::net::Address& sfap::net::AddressSet::operator[](std::size_t i) const noexcept {
+    return slots_[i].address;
+}
+
+std::uint32_t sfap::net::AddressSet::outstanding(std::size_t i) const noexcept {
+    return slots_[i].outstanding.load(std::memory_order_relaxed);
+}
+
+sfap::net::AddressSet::Lease sfap::net::AddressSet::acquire() noexcept {
+    if (size_ == 0)
+        return {};
+    const std::size_t i{choose()};
+    return Lease{&slots_[i], i};
+}
+
+std::size_t sfap::net::AddressSet::choose() noexcept {
+    if (size_ == 1)
+        return 0;
+
+    switch (policy_) {
+    case BalancePolicy::ROUND_ROBIN:
+        return cursor_.fetch_add(1, std::memory_order_relaxed) % size_;
+
+    case BalancePolicy::POWER_OF_TWO_CHOICES: {
+        // Second choice is drawn from the other size_ - 1 slots, so the two always differ.
+        const std::size_t a{random_below(size_)};
+        const std::size_t b{(a + 1 + random_below(size_ - 1)) % size_};
+        return outstanding(b) < outstanding(a) ? b : a;
+    }
+
+    case BalancePolicy::LEAST_OUTSTANDING: {
+        const std::size_t start{cursor_.fetch_add(1, std::memory_order_relaxed) % size_};
+        std::size_t best{start};
+        std::uint32_t best_load{outstanding(start)};
+        for (std::size_t step = 1; step < size_ && best_load != 0; ++step) {
+            const std::size_t i{(start + step) % size_};
+            if (const std::uint32_t load = outstanding(i); load < best_load) {
+                best = i;
+                best_load = load;
+            }
+        }
+        return best;
+    }
+    }
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+/*!
+  \file
+  \brief Happy Eyeballs connection establishment (RFC 8305).
+
+  \details
+  Proactor::connect_any() races connection attempts to every resolved
+  address. Attempts and the stagger timer run as detached coroutines that
+  report to a shared, reference-counted Race; the caller's coroutine wakes
+  on each report and decides whether to start the next attempt.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <array>
+#include <coroutine>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/dns.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/detached.hpp>
+#include <sfap/utils/intern.hpp>
+#include <sfap/utils/task.hpp>
+
+namespace {
+
+using sfap::detached;
+using sfap::net::Address;
+using sfap::net::AddressList;
+using sfap::net::Proactor;
+using sfap::net::ResolveMode;
+using sfap::net::socket_t;
+
+/*!
+  \brief State shared by connect_any() and the coroutines it spawns.
+  \details Everything runs on the proactor's loop thread, so no locking is
+           needed. The last of the owners to let go deletes it.
+*/
+struct Race {
+    explicit Race(Proactor& owner) noexcept : proactor(owner) {}
+
+    ~Race() noexcept {
+        delete[] in_flight;
+    }
+
+    Race(const Race&) = delete;
+    Race& operator=(const Race&) = delete;
+
+    Proactor& proactor;
+    std::size_t refs{1};                ///< connect_any() plus every attempt and timer still running.
+    std::coroutine_handle<> waiter;     ///< connect_any() while it waits for news.
+    std::size_t events{};               ///< Reports not yet seen by connect_any().
+    std::uint64_t generation{};         ///< Bumped on every wakeup; older timers are stale.
+    std::size_t running{};              ///< Attempts not finished yet.
+    socket_t* in_flight{};              ///< Socket of each attempt by index while it runs, else `0`.
+    std::optional<sfap::net::Socket> winner;
+    bool winner_v6{};
+    sfap::error_code last_error{sfap::no_error()};
+
+    void retain() noexcept {
+        ++refs;
+    }
+
+    void release() noexcept {
+        if (--refs == 0)
+            delete this;
+    }
+
+    /// \brief Wake connect_any() through the proactor, never inline.
+    void notify() noexcept {
+        ++events;
+        if (waiter)
+            proactor.post(std::exchange(waiter, {}));
+    }
+
+    /// \brief Suspends until at least one report arrived since the last wait.
+    struct Wait {
+        Race& race;
+
+        bool await_ready() const noexcept {
+            return race.events > 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            race.waiter = h;
+        }
+
+        void await_resume() noexcept {
+            race.events = 0;
+            ++race.generation;
+        }
+    };
+};
+
+detached attempt(Race* race, std::size_t index, Address address, Proactor::duration timeout) noexcept {
+    auto socket = race->proactor.open_stream(address);
+    if (!socket) {
+        race->last_error = socket.error();
+    } else {
+        const socket_t sid{socket->get_handle()};
+        race->in_flight[index] = sid;
+        const auto error = co_await race->proactor.socket_connect(sid, address, timeout);
+        race->in_flight[index] = 0;
+
+        if (error) {
+            if (!race->winner)
+                race->last_error = error;
+        } else if (!race->winner) {
+            race->winner.emplace(std::move(*socket));
+            race->winner_v6 = address.get_address()->ip_.is_6();
+        }
+    }
+
+    --race->running;
+    race->notify();
+    race->release();
+}
+
+detached stagger(Race* race, std::uint64_t generation, Proactor::duration delay) noexcept {
+    co_await race->proactor.sleep_for(delay);
+    // Timers cannot be cancelled; one armed before the last wakeup is ignored.
+    if (race->generation == generation)
+        race->notify();
+    race->release();
+}
+
+/// \brief Slots of the `preferences()` table; a power of two.
+constexpr std::size_t max_remembered_hosts{1024};
+
+/*!
+  \brief Family that won the last race per host.
+  \details Direct-mapped on the host's InternPool::global() pointer, so
+           lookups neither copy nor hash the characters. A host that maps to
+           an occupied slot replaces its previous owner: the table is only a
+           hint, and forgetting a host just costs it the default order.
+*/
+struct Preferences {
+    struct Slot {
+        const char* host{}; ///< Interned host name, `nullptr` while unused.
+        bool v6{};          ///< `true` if IPv6 won the last race.
+    };
+
+    std::mutex mutex;
+    std::array<Slot, max_remembered_hosts> slots{};
+
+    Slot& slot(const char* host) noexcept {
+        return slots[std::hash<const char*>{}(host) % max_remembered_hosts];
+    }
+};
+
+Preferences& preferences() noexcept {
+    static Preferences table;
+    return table;
+}
+
+std::optional<bool> remembered_v6(std::string_view host) noexcept {
+    // A host that was never interned has never won a race.
+    const auto interned{sfap::InternPool::global().find(host)};
+    if (!interned)
+        return std::nullopt;
+
+    Preferences& table{preferences()};
+    std::lock_guard lock{table.mutex};
+    const Preferences::Slot& slot{table.slot(interned->data())};
+    if (slot.host != interned->data())
+        return std::nullopt;
+    return slot.v6;
+}
+
+void remember_v6(std::string_view host, bool v6) noexcept {
+    // Out of memory only means the preference is not kept.
+    const auto interned{sfap::InternPool::global().intern(host)};
+    if (!interned)
+        return;
+
+    Preferences& table{preferences()};
+    std::lock_guard lock{table.mutex};
+    Preferences::Slot& slot{table.slot(interned->data())};
+    slot.host = interned->data();
+    slot.v6 = v6;
+}
+
+/*!
+  \brief Alternate the families of \p ips, starting with IPv6 if \p v6_first (RFC 8305 section 4).
+  \return `false` if \p order could not grow to hold every address.
+*/
+bool interleave(const AddressList& ips, bool v6_first, AddressList& order) noexcept {
+    const sfap::net::ipx_t* first{ips.begin()};
+    const sfap::net::ipx_t* second{ips.begin()};
+    const auto next_of = [&](const sfap::net::ipx_t*& it, bool v6) noexcept {
+        while (it != ips.end() && it->is_6() != v6)
+            ++it;
+        return it != ips.end() ? it++ : nullptr;
+    };
+
+    while (order.size() < ips.size()) {
+        if (const auto* ip{next_of(first, v6_first)}; ip && !order.push_back(*ip))
+            return false;
+        if (const auto* ip{next_of(second, !v6_first)}; ip && !order.push_back(*ip))
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+sfap::task<sfap::result<sfap::net::Socket>> sfap::net::Proactor::connect_any(std::string_view host, port_t port,
+                                                                            ResolveMode mode,
+                                                                            duration timeout) noexcept {
+    co_return co_await connect_any(host, port, mode, timeout, dns::Config::system());
+}
+
+sfap::task<sfap::result<sfap::net::Socket>>
+sfap::net::Proactor::connect_any(std::string_view host, port_t port, ResolveMode mode, duration timeout,
+                                 const dns::Config& config) noexcept {
+    const auto resolved = co_await resolve_all(host, mode, config);
+    if (!resolved)
+        co_return unexpected<error_code>(resolved.error());
+
+    const bool v6_first{remembered_v6(host).value_or(mode == ResolveMode::PREFER_IPV6 ||
+                                                     mode == ResolveMode::REQUIRE_IPV6)};
+    AddressList order;
+    if (!interleave(*resolved, v6_first, order))
+        co_return generic_error(errc::NOT_ENOUGH_MEMORY);
+
+    Race* race{new (std::nothrow) Race{*this}};
+    if (race)
+        race->in_flight = new (std::nothrow) socket_t[order.size()]{};
+    if (!race || !race->in_flight) {
+        delete race;
+        co_return generic_error(errc::NOT_ENOUGH_MEMORY);
+    }
+
+    std::size_t next{};
+    while (!race->winner) {
+        if (next < order.size()) {
+            // Each wakeup is a failed attempt or an expired timer: either way the next address goes.
+            race->retain();
+            ++race->running;
+            attempt(race, next, Address{order[next], port}, timeout);
+            ++next;
+
+            if (!race->winner && race->running > 0 && next < order.size()) {
+                race->retain();
+                stagger(race, race->generation, connection_attempt_delay);
+            }
+        } else if (race->running == 0) {
+            break;
+        }
+
+        co_await Race::Wait{*race};
+    }
+
+    // A cancelled attempt may finish inline and clear its own slot; the others are untouched.
+    for (std::size_t i = 0; i < order.size(); ++i)
+        if (const socket_t loser{race->in_flight[i]}; loser != 0)
+            cancel(loser);
+
+    sfap::result<Socket> out{unexpected<error_code>(race->last_error)};
+    if (race->winner) {
+        out.emplace(std::move(*race->winner));
+        remember_v6(host, race->winner_v6);
+    }
+    race->release();
+
+    co_return std::move(out);
+}
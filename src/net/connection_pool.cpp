@@ -0,0 +1,591 @@
+/*!
+  \file
+  \brief Outbound connection pool implementation.
+
+  \details
+  The pool's state lives on the heap with a reference count shared by the
+  pool, its leases, pending acquires and the maintenance timer, so any of
+  them can finish after the pool itself is gone.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <coroutine>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/connection_pool.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/utils/detached.hpp>
+#include <sfap/utils/task.hpp>
+
+struct sfap::net::ConnectionPool::State {
+    /// \brief Connection waiting in a peer's idle list.
+    struct Idle {
+        Socket socket;
+        clock::time_point since; ///< When it was returned.
+    };
+
+    /// \brief acquire() parked until a connection or a free slot shows up.
+    struct Waiter {
+        std::coroutine_handle<> handle;
+        std::optional<Socket> socket; ///< Set when a released connection was handed over directly.
+        Waiter* next{};               ///< Next in the peer's queue.
+    };
+
+    struct Peer {
+        explicit Peer(const Address& a) noexcept : address(a) {}
+
+        ~Peer() noexcept {
+            delete[] idle;
+        }
+
+        Address address;
+        Peer* prev{};                ///< Neighbours in State::first's list.
+        Peer* next{};
+        Idle* idle{};                ///< `max_idle_per_host` slots, most recently returned last.
+        std::size_t idle_count{};
+        Waiter* first_waiter{};      ///< Served in order.
+        Waiter* last_waiter{};
+        std::size_t live{};          ///< Idle, leased and connecting.
+        std::size_t leased{};        ///< Out on leases.
+        std::size_t acquires{};      ///< Since the last maintenance pass.
+        bool warming{};              ///< A background pre-warm is running.
+
+        void push_waiter(Waiter* waiter) noexcept {
+            (last_waiter ? last_waiter->next : first_waiter) = waiter;
+            last_waiter = waiter;
+        }
+
+        Waiter* pop_waiter() noexcept {
+            Waiter* waiter{first_waiter};
+            if (waiter) {
+                first_waiter = waiter->next;
+                if (!first_waiter)
+                    last_waiter = nullptr;
+            }
+            return waiter;
+        }
+    };
+
+    /// \brief Suspends an acquire() in \p peer's wait queue.
+    struct Wait {
+        Peer& peer;
+        Waiter& waiter;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            waiter.handle = h;
+            peer.push_waiter(&waiter);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    State(Proactor& owner, const ConnectionPoolOptions& tuning) noexcept : proactor(owner), options(tuning) {}
+
+    ~State() noexcept {
+        clear_peers();
+        delete[] index;
+    }
+
+    Proactor& proactor;
+    ConnectionPoolOptions options;
+    std::size_t refs{1}; ///< The pool plus every lease and coroutine using the state.
+    bool closed{};       ///< The pool was destroyed.
+    bool maintaining{};  ///< The maintenance timer runs.
+
+    Peer* first{};       ///< Every peer, for iteration.
+    Peer** index{};      ///< Open-addressed by Address::hash() with linear probing, `nullptr` marks a free slot.
+    std::size_t mask{};  ///< Index slots minus one.
+    std::size_t count{}; ///< Peers held.
+
+    std::uint64_t reused{};
+    std::uint64_t connected{};
+    std::uint64_t prewarmed{};
+    std::uint64_t waited{};
+    std::uint64_t dead{};
+    std::uint64_t expired{};
+
+    void retain() noexcept {
+        ++refs;
+    }
+
+    void release() noexcept {
+        if (--refs == 0)
+            delete this;
+    }
+
+    std::size_t home(const Address& address) const noexcept {
+        return static_cast<std::size_t>(address.hash()) & mask;
+    }
+
+    /// \return Peer for \p address, `nullptr` if there is none.
+    Peer* find(const Address& address) const noexcept {
+        if (!index)
+            return nullptr;
+        for (std::size_t slot = home(address);; slot = (slot + 1) & mask) {
+            if (!index[slot] || index[slot]->address == address)
+                return index[slot];
+        }
+    }
+
+    /// \brief Keep the index at most half full, doubling it when needed.
+    /// \return `false` on allocation failure; the index is unchanged then.
+    bool reserve_peer() noexcept {
+        if (index && (count + 1) * 2 <= mask + 1)
+            return true;
+
+        const std::size_t slots{index ? (mask + 1) * 2 : 16};
+        Peer** grown{new (std::nothrow) Peer*[slots]{}};
+        if (!grown)
+            return false;
+
+        delete[] index;
+        index = grown;
+        mask = slots - 1;
+        for (Peer* peer = first; peer; peer = peer->next) {
+            std::size_t slot{home(peer->address)};
+            while (index[slot])
+                slot = (slot + 1) & mask;
+            index[slot] = peer;
+        }
+        return true;
+    }
+
+    /// \return Peer for \p address, created if missing; `nullptr` on allocation failure.
+    Peer* find_or_add(const Address& address) noexcept {
+        if (Peer* peer = find(address))
+            return peer;
+        if (!reserve_peer())
+            return nullptr;
+
+        Peer* peer{new (std::nothrow) Peer{address}};
+        if (!peer)
+            return nullptr;
+        if (options.max_idle_per_host > 0) {
+            peer->idle = new (std::nothrow) Idle[options.max_idle_per_host];
+            if (!peer->idle) {
+                delete peer;
+                return nullptr;
+            }
+        }
+
+        std::size_t slot{home(address)};
+        while (index[slot])
+            slot = (slot + 1) & mask;
+        index[slot] = peer;
+
+        peer->next = first;
+        if (first)
+            first->prev = peer;
+        first = peer;
+        ++count;
+        return peer;
+    }
+
+    /// \brief Unlink and delete \p peer. Its idle connections are closed.
+    void erase(Peer* peer) noexcept {
+        (peer->prev ? peer->prev->next : first) = peer->next;
+        if (peer->next)
+            peer->next->prev = peer->prev;
+
+        std::size_t slot{home(peer->address)};
+        while (index[slot] != peer)
+            slot = (slot + 1) & mask;
+
+        // Backward-shift deletion: pull later entries of the probe run into the hole
+        // unless that would move them in front of their home slot.
+        for (std::size_t next = (slot + 1) & mask; index[next]; next = (next + 1) & mask) {
+            if (((next - home(index[next]->address)) & mask) >= ((next - slot) & mask)) {
+                index[slot] = index[next];
+                slot = next;
+            }
+        }
+        index[slot] = nullptr;
+
+        --count;
+        delete peer;
+    }
+
+    /// \brief Delete every peer without waking its waiters.
+    void clear_peers() noexcept {
+        while (first) {
+            Peer* next{first->next};
+            delete first;
+            first = next;
+        }
+        if (index)
+            std::fill_n(index, mask + 1, nullptr);
+        count = 0;
+    }
+
+    /// \brief Pop the freshest healthy idle connection, closing stale and dead ones on the way.
+    std::optional<Socket> take_idle(Peer& peer) noexcept {
+        const auto now{clock::now()};
+        while (peer.idle_count > 0) {
+            Idle& last{peer.idle[--peer.idle_count]};
+            Socket socket{std::move(last.socket)};
+
+            if (now - last.since >= options.idle_timeout) {
+                ++expired;
+            } else if (!proactor.socket_alive(socket.get_handle())) {
+                ++dead;
+            } else {
+                ++peer.leased;
+                return std::optional<Socket>{std::in_place, std::move(socket)};
+            }
+            --peer.live;
+        }
+        return std::nullopt;
+    }
+
+    /// \brief Resume the first waiter of \p peer without a connection, so it can open its own.
+    void wake(Peer& peer) noexcept {
+        if (Waiter* waiter = peer.pop_waiter())
+            proactor.post(waiter->handle);
+    }
+
+    /// \brief Hand healthy \p socket to the first waiter, or keep it idle if there is room.
+    void recycle(Peer& peer, Socket&& socket) noexcept {
+        if (Waiter* waiter = peer.pop_waiter()) {
+            waiter->socket.emplace(std::move(socket));
+            ++peer.leased;
+            proactor.post(waiter->handle);
+            return;
+        }
+
+        if (peer.idle_count < options.max_idle_per_host) {
+            Idle& slot{peer.idle[peer.idle_count++]};
+            slot.socket = std::move(socket);
+            slot.since = clock::now();
+            return;
+        }
+
+        Socket extra{std::move(socket)};
+        --peer.live;
+    }
+
+    void give_back(const Address& address, Socket&& socket, bool reuse) noexcept {
+        Socket returned{std::move(socket)};
+        if (closed)
+            return;
+
+        Peer* peer{find(address)};
+        if (!peer)
+            return;
+
+        --peer->leased;
+        if (reuse && proactor.socket_alive(returned.get_handle())) {
+            recycle(*peer, std::move(returned));
+            return;
+        }
+
+        --peer->live;
+        wake(*peer);
+    }
+
+    void evict(clock::time_point now) noexcept {
+        for (Peer* peer = first; peer;) {
+            Peer* next{peer->next};
+
+            std::size_t kept{};
+            for (std::size_t i = 0; i < peer->idle_count; ++i) {
+                Idle& idle{peer->idle[i]};
+                const bool stale{now - idle.since >= options.idle_timeout};
+                if (stale || !proactor.socket_alive(idle.socket.get_handle())) {
+                    ++(stale ? expired : dead);
+                    Socket closing{std::move(idle.socket)};
+                    --peer->live;
+                } else {
+                    if (kept != i)
+                        peer->idle[kept] = std::move(idle);
+                    ++kept;
+                }
+            }
+            peer->idle_count = kept;
+
+            if (peer->live == 0 && !peer->first_waiter && peer->acquires == 0 && !peer->warming)
+                erase(peer);
+            peer = next;
+        }
+    }
+
+    /// \brief Open connections to \p address one by one until \p count are idle or a limit is hit.
+    sfap::task<std::size_t> fill(Address address, std::size_t count) noexcept {
+        const std::size_t target{std::min(count, options.max_idle_per_host)};
+        std::size_t opened{};
+
+        while (!closed) {
+            Peer* peer{find_or_add(address)};
+            if (!peer || peer->idle_count >= target || peer->live >= options.max_per_host || peer->first_waiter)
+                break;
+
+            ++peer->live;
+            auto socket = co_await proactor.connect(address, options.connect_timeout, options.socket);
+            if (closed)
+                break;
+
+            // Peers with live connections are never evicted, so it is still there.
+            Peer& after{*find(address)};
+            if (!socket) {
+                --after.live;
+                wake(after);
+                break;
+            }
+            ++prewarmed;
+            ++opened;
+            recycle(after, std::move(*socket));
+        }
+
+        co_return opened;
+    }
+
+    /// \brief Drops one reference when the coroutine holding it ends.
+    struct Ref {
+        State* state;
+
+        ~Ref() {
+            state->release();
+        }
+    };
+
+    /// \brief Background fill() for a hot peer.
+    static sfap::detached warm(State* state, Address address) noexcept {
+        const Ref ref{state};
+        co_await state->fill(address, state->options.prewarm_idle);
+        if (state->closed)
+            co_return;
+        if (Peer* peer = state->find(address))
+            peer->warming = false;
+    }
+
+    /// \brief Timer loop evicting idle connections and pre-warming hot peers until the pool closes.
+    static sfap::detached maintain(State* state) noexcept {
+        const Ref ref{state};
+        while (!state->closed) {
+            co_await state->proactor.sleep_for(state->options.maintenance_interval);
+            if (state->closed)
+                break;
+
+            state->evict(clock::now());
+
+            for (Peer* peer = state->first; peer; peer = peer->next) {
+                if (state->options.prewarm_idle > 0 && peer->acquires >= state->options.hot_acquires &&
+                    !peer->warming) {
+                    peer->warming = true;
+                    state->retain();
+                    warm(state, peer->address);
+                }
+                peer->acquires = 0;
+            }
+        }
+        state->maintaining = false;
+    }
+
+    void start_maintenance() noexcept {
+        if (maintaining || closed || options.maintenance_interval <= duration::zero())
+            return;
+        maintaining = true;
+        retain();
+        maintain(this);
+    }
+
+    /// \brief Stop serving: wake every waiter and close every idle connection.
+    void close() noexcept {
+        closed = true;
+
+        // Detach the peers first: resumed waiters see `closed` and leave
+        // without touching them, and may end before post() returns.
+        Peer* peers{std::exchange(first, nullptr)};
+        if (index)
+            std::fill_n(index, mask + 1, nullptr);
+        count = 0;
+
+        while (peers) {
+            Peer* next{peers->next};
+            for (Waiter* waiter = peers->first_waiter; waiter;) {
+                Waiter* after{waiter->next};
+                proactor.post(waiter->handle);
+                waiter = after;
+            }
+            delete peers;
+            peers = next;
+        }
+    }
+};
+
+sfap::net::ConnectionPool::Lease::Lease(State* state, const Address& address, Socket&& socket) noexcept
+    : state_(state), address_(address), socket_(std::move(socket)) {
+    state_->retain();
+}
+
+sfap::net::ConnectionPool::Lease::~Lease() noexcept {
+    give_back(true);
+}
+
+sfap::net::ConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : state_(std::exchange(other.state_, nullptr)), address_(other.address_), socket_(std::move(other.socket_)) {}
+
+sfap::net::ConnectionPool::Lease& sfap::net::ConnectionPool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        give_back(true);
+        state_ = std::exchange(other.state_, nullptr);
+        address_ = other.address_;
+        socket_ = std::move(other.socket_);
+    }
+    return *this;
+}
+
+sfap::net::ConnectionPool::Lease::operator bool() const noexcept {
+    return state_ != nullptr;
+}
+
+sfap::net::Socket& sfap::net::ConnectionPool::Lease::socket() noexcept {
+    return socket_;
+}
+
+const sfap::net::Address& sfap::net::ConnectionPool::Lease::address() const noexcept {
+    return address_;
+}
+
+void sfap::net::ConnectionPool::Lease::release() noexcept {
+    give_back(true);
+}
+
+void sfap::net::ConnectionPool::Lease::discard() noexcept {
+    give_back(false);
+}
+
+void sfap::net::ConnectionPool::Lease::give_back(bool reuse) noexcept {
+    if (!state_)
+        return;
+    State* state{std::exchange(state_, nullptr)};
+    state->give_back(address_, std::move(socket_), reuse);
+    state->release();
+}
+
+sfap::net::ConnectionPool::ConnectionPool(Proactor& proactor, const ConnectionPoolOptions& options) noexcept
+    : state_(new (std::nothrow) State{proactor, options}) {}
+
+sfap::net::ConnectionPool::~ConnectionPool() noexcept {
+    if (!state_)
+        return;
+    state_->close();
+    state_->release();
+}
+
+sfap::net::ConnectionPool::operator bool() const noexcept {
+    return state_ != nullptr;
+}
+
+sfap::task<sfap::result<sfap::net::ConnectionPool::Lease>>
+sfap::net::ConnectionPool::acquire(const Address& address) noexcept {
+    State* state{state_};
+    if (!state)
+        co_return generic_error(errc::NOT_ENOUGH_MEMORY);
+
+    state->retain();
+    const State::Ref ref{state};
+    const Address peer_address{address};
+    state->start_maintenance();
+    if (State::Peer* peer = state->find_or_add(peer_address))
+        ++peer->acquires;
+
+    for (;;) {
+        State::Peer* found{state->find_or_add(peer_address)};
+        if (!found)
+            co_return generic_error(errc::NOT_ENOUGH_MEMORY);
+        State::Peer& peer{*found};
+
+        if (auto socket = state->take_idle(peer)) {
+            ++state->reused;
+            co_return Lease{state, peer_address, std::move(*socket)};
+        }
+
+        if (peer.live < state->options.max_per_host) {
+            ++peer.live;
+            ++state->connected;
+            auto socket = co_await state->proactor.connect(peer_address, state->options.connect_timeout,
+                                                           state->options.socket);
+            if (state->closed)
+                co_return network_error(ECANCELED);
+
+            // Peers with live connections are never evicted, so it is still there.
+            State::Peer& after{*state->find(peer_address)};
+            if (!socket) {
+                --after.live;
+                state->wake(after);
+                co_return unexpected<error_code>(socket.error());
+            }
+            ++after.leased;
+            co_return Lease{state, peer_address, std::move(*socket)};
+        }
+
+        ++state->waited;
+        State::Waiter waiter;
+        co_await State::Wait{peer, waiter};
+        if (state->closed)
+            co_return network_error(ECANCELED);
+        if (waiter.socket)
+            co_return Lease{state, peer_address, std::move(*waiter.socket)};
+    }
+}
+
+sfap::task<std::size_t> sfap::net::ConnectionPool::prewarm(const Address& address, std::size_t count) noexcept {
+    State* state{state_};
+    if (!state)
+        co_return 0;
+
+    state->retain();
+    const State::Ref ref{state};
+    state->start_maintenance();
+    co_return co_await state->fill(address, count);
+}
+
+void sfap::net::ConnectionPool::evict_idle() noexcept {
+    if (state_)
+        state_->evict(clock::now());
+}
+
+std::size_t sfap::net::ConnectionPool::idle(const Address& address) const noexcept {
+    if (!state_)
+        return 0;
+    const State::Peer* peer{state_->find(address)};
+    return peer ? peer->idle_count : 0;
+}
+
+sfap::net::ConnectionPool::Stats sfap::net::ConnectionPool::stats() const noexcept {
+    if (!state_)
+        return {};
+
+    Stats stats{
+        .reused = state_->reused,
+        .connected = state_->connected,
+        .prewarmed = state_->prewarmed,
+        .waited = state_->waited,
+        .dead = state_->dead,
+        .expired = state_->expired,
+        .idle = 0,
+        .leased = 0,
+    };
+    for (const State::Peer* peer = state_->first; peer; peer = peer->next) {
+        stats.idle += peer->idle_count;
+        stats.leased += peer->leased;
+    }
+    return stats;
+}
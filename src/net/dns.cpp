@@ -0,0 +1,843 @@
+/*!
+  \file
+  \brief DNS stub resolver implementation.
+
+  \details
+  Message codec, configuration parsing, Proactor::resolve() and
+  Proactor::resolve_all(). Queries for A and AAAA go out back to back on one
+  UDP socket and their answers are matched by ID as they arrive; truncated
+  answers are fetched again over TCP.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <optional>
+#include <random>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/dns.hpp>
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/task.hpp>
+
+namespace {
+
+using sfap::net::ipx_t;
+using sfap::net::ResolveMode;
+using sfap::net::dns::max_name_size;
+using sfap::net::dns::Name;
+using sfap::net::dns::Type;
+
+struct dns_category final : public sfap::error_category {
+    const char* name() const noexcept override {
+        return "dns";
+    }
+
+    const char* message(int code) const noexcept override {
+        switch (static_cast<sfap::net::dns::errc>(code)) {
+        case sfap::net::dns::errc::OK:
+            return "ok";
+        case sfap::net::dns::errc::FORMAT_ERROR:
+            return "server could not parse the query";
+        case sfap::net::dns::errc::SERVER_FAILURE:
+            return "server failure";
+        case sfap::net::dns::errc::NAME_ERROR:
+            return "name does not exist";
+        case sfap::net::dns::errc::NOT_IMPLEMENTED:
+            return "query not implemented by server";
+        case sfap::net::dns::errc::REFUSED:
+            return "query refused";
+        case sfap::net::dns::errc::NO_DATA:
+            return "no address of the requested family";
+        case sfap::net::dns::errc::MALFORMED:
+            return "malformed message";
+        case sfap::net::dns::errc::TIMEOUT:
+            return "no name server answered in time";
+        case sfap::net::dns::errc::NO_SERVERS:
+            return "no name server configured";
+        }
+        return "unknown error";
+    }
+};
+
+constexpr std::size_t header_size{12};
+constexpr std::uint16_t class_in{1};
+
+constexpr std::uint16_t flag_response{0x8000};
+constexpr std::uint16_t flag_truncated{0x0200};
+constexpr std::uint16_t flag_recursion_desired{0x0100};
+
+constexpr char lower(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string_view strip_root(std::string_view name) noexcept {
+    if (!name.empty() && name.back() == '.')
+        name.remove_suffix(1);
+    return name;
+}
+
+/// \return `false` if \p text is longer than max_name_size.
+bool lowercase(std::string_view text, Name& out) noexcept {
+    if (text.size() > max_name_size)
+        return false;
+    out.size = text.size();
+    std::transform(text.begin(), text.end(), out.chars.begin(), lower);
+    return true;
+}
+
+std::uint16_t read16(std::span<const std::byte> message, std::size_t at) noexcept {
+    return static_cast<std::uint16_t>((std::to_integer<unsigned>(message[at]) << 8) |
+                                      std::to_integer<unsigned>(message[at + 1]));
+}
+
+std::uint32_t read32(std::span<const std::byte> message, std::size_t at) noexcept {
+    return (std::uint32_t{read16(message, at)} << 16) | read16(message, at + 2);
+}
+
+void write16(std::byte* out, std::uint16_t value) noexcept {
+    out[0] = static_cast<std::byte>(value >> 8);
+    out[1] = static_cast<std::byte>(value);
+}
+
+/*!
+  \brief Read the possibly compressed name at \p at.
+  \param name Receives the lowercase dotted name, without the trailing dot.
+  \param next Receives the offset just past the name in the record.
+  \return `false` if the name runs off the message, loops or is too long.
+*/
+bool read_name(std::span<const std::byte> message, std::size_t at, Name& name, std::size_t& next) noexcept {
+    name.size = 0;
+    std::optional<std::size_t> end;
+
+    // Every pointer must go backwards, so a name cannot contain more jumps than the message has bytes.
+    for (std::size_t jumps = 0;;) {
+        if (at >= message.size())
+            return false;
+        const unsigned length{std::to_integer<unsigned>(message[at])};
+
+        if ((length & 0xC0) == 0xC0) {
+            if (at + 1 >= message.size())
+                return false;
+            const std::size_t target{read16(message, at) & 0x3FFFu};
+            if (target >= at || ++jumps > message.size())
+                return false;
+            if (!end)
+                end = at + 2;
+            at = target;
+            continue;
+        }
+        if ((length & 0xC0) != 0)
+            return false;
+
+        if (length == 0) {
+            next = end ? *end : at + 1;
+            return true;
+        }
+
+        const std::size_t dot{name.size != 0 ? 1u : 0u};
+        if (at + 1 + length > message.size() || name.size + dot + length > max_name_size)
+            return false;
+        if (dot != 0)
+            name.chars[name.size++] = '.';
+        for (std::size_t i = 0; i < length; ++i)
+            name.chars[name.size++] = lower(static_cast<char>(message[at + 1 + i]));
+        at += 1 + length;
+    }
+}
+
+std::optional<ipx_t> pick(ResolveMode mode, const std::optional<ipx_t>& v4, const std::optional<ipx_t>& v6) noexcept {
+    switch (mode) {
+    case ResolveMode::REQUIRE_IPV4:
+        return v4;
+    case ResolveMode::REQUIRE_IPV6:
+        return v6;
+    case ResolveMode::PREFER_IPV4:
+        return v4 ? v4 : v6;
+    case ResolveMode::PREFER_IPV6:
+        return v6 ? v6 : v4;
+    }
+    return std::nullopt;
+}
+
+/*!
+  \brief Append the contents of \p path to \p text; a missing file reads as empty.
+  \return `false` if \p text could not grow.
+*/
+bool read_file(const char* path, sfap::Buffer& text) noexcept {
+    std::FILE* file{std::fopen(path, "rb")};
+    if (!file)
+        return true;
+
+    std::array<std::byte, 4096> chunk;
+    bool ok{true};
+    for (std::size_t n; ok && (n = std::fread(chunk.data(), 1, chunk.size(), file)) != 0;)
+        ok = text.append({chunk.data(), n});
+    std::fclose(file);
+    return ok;
+}
+
+std::string_view as_text(const sfap::Buffer& buffer) noexcept {
+    return {reinterpret_cast<const char*>(buffer.data()), buffer.size()};
+}
+
+/// \brief Calls \p f with the fields of each line of \p text; `#` and \p comment start comments.
+template <typename F> void for_each_line(std::string_view text, char comment, F&& f) {
+    constexpr std::string_view blanks{" \t\r"};
+    std::array<std::string_view, 16> fields;
+
+    while (!text.empty()) {
+        const std::size_t eol{std::min(text.find('\n'), text.size())};
+        std::string_view line{text.substr(0, eol)};
+        text.remove_prefix(std::min(eol + 1, text.size()));
+
+        line = line.substr(0, std::min({line.find('#'), line.find(comment), line.size()}));
+
+        std::size_t count{};
+        while (count < fields.size()) {
+            const std::size_t start{line.find_first_not_of(blanks)};
+            if (start == std::string_view::npos)
+                break;
+            line.remove_prefix(start);
+            const std::size_t stop{std::min(line.find_first_of(blanks), line.size())};
+            fields[count++] = line.substr(0, stop);
+            line.remove_prefix(stop);
+        }
+        if (count != 0)
+            f(std::span<const std::string_view>{fields.data(), count});
+    }
+}
+
+std::optional<unsigned> option_value(std::string_view option, std::string_view key, unsigned limit) noexcept {
+    if (!option.starts_with(key) || option.size() == key.size())
+        return std::nullopt;
+
+    unsigned value{};
+    for (const char c : option.substr(key.size())) {
+        if (c < '0' || c > '9')
+            return std::nullopt;
+        value = std::min(value * 10 + static_cast<unsigned>(c - '0'), limit);
+    }
+    return value;
+}
+
+std::uint16_t next_query_id() noexcept {
+    thread_local std::mt19937 generator{std::random_device{}()};
+    return static_cast<std::uint16_t>(generator());
+}
+
+// ---- Exchange with one name server ----------------------------------------------------------------------------
+
+using sfap::net::Proactor;
+using sfap::net::dns::Response;
+
+/// \brief What one question returned.
+struct Outcome {
+    sfap::net::AddressList addresses; ///< Addresses of the answer, in answer order.
+    bool exists{};                    ///< `false` for NXDOMAIN.
+};
+
+/// \brief Outcomes in the order of the asked types.
+using Answers = std::array<std::optional<Outcome>, 2>;
+
+struct Query {
+    Type type{};
+    std::uint16_t id{};
+    std::size_t size{};
+    std::array<std::byte, sfap::net::dns::max_udp_message> message{};
+
+    std::span<const std::byte> bytes() const noexcept {
+        return {message.data(), size};
+    }
+};
+
+/// \brief Turn a response code into an outcome; server-side failures mean "try the next server".
+sfap::result<Outcome> classify(const Response& response) noexcept {
+    switch (response.rcode) {
+    case 0: {
+        Outcome outcome{{}, true};
+        for (const ipx_t& ip : response.answers())
+            if (!outcome.addresses.contains(ip) && !outcome.addresses.push_back(ip))
+                return sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+        return outcome;
+    }
+    case 3:
+        return Outcome{{}, false};
+    default:
+        if (response.rcode <= 5)
+            return sfap::net::dns::error(static_cast<sfap::net::dns::errc>(response.rcode));
+        return sfap::net::dns::error(sfap::net::dns::errc::SERVER_FAILURE);
+    }
+}
+
+bool is_timeout(const sfap::error_code& error) noexcept {
+    return error == sfap::network_error(ETIMEDOUT).error();
+}
+
+/// \brief Fill \p data completely before \p deadline.
+sfap::task<sfap::error_code> receive_exact(Proactor& proactor, sfap::net::socket_t handle, std::span<std::byte> data,
+                                           Proactor::time_point deadline) noexcept {
+    while (!data.empty()) {
+        const auto left{deadline - Proactor::clock::now()};
+        if (left <= Proactor::duration::zero())
+            co_return sfap::net::dns::error(sfap::net::dns::errc::TIMEOUT).error();
+
+        const auto received = co_await proactor.socket_recv_for(handle, data, left);
+        if (!received)
+            co_return is_timeout(received.error()) ? sfap::net::dns::error(sfap::net::dns::errc::TIMEOUT).error()
+                                                   : received.error();
+        if (*received == 0)
+            co_return sfap::net::dns::error(sfap::net::dns::errc::MALFORMED).error();
+        data = data.subspan(*received);
+    }
+    co_return sfap::no_error();
+}
+
+/// \brief Ask \p query again over TCP after a truncated UDP answer.
+sfap::task<sfap::result<Response>> exchange_tcp(Proactor& proactor, const sfap::net::Address& server,
+                                                const Query& query, std::string_view name,
+                                                Proactor::time_point deadline) noexcept {
+    auto connection = co_await proactor.connect(server, deadline - Proactor::clock::now());
+    if (!connection)
+        co_return sfap::unexpected<sfap::error_code>(connection.error());
+    const sfap::net::socket_t handle{connection->get_handle()};
+
+    // TCP messages carry a two-byte length prefix (RFC 1035 section 4.2.2).
+    std::array<std::byte, 2 + sfap::net::dns::max_udp_message> framed;
+    write16(framed.data(), static_cast<std::uint16_t>(query.size));
+    std::copy_n(query.message.begin(), query.size, framed.begin() + 2);
+
+    std::span<const std::byte> pending{framed.data(), 2 + query.size};
+    while (!pending.empty()) {
+        const auto sent = co_await proactor.socket_send(handle, pending);
+        if (!sent)
+            co_return sfap::unexpected<sfap::error_code>(sent.error());
+        if (*sent == 0)
+            co_return sfap::net::dns::error(sfap::net::dns::errc::MALFORMED);
+        pending = pending.subspan(*sent);
+    }
+
+    std::array<std::byte, 2> prefix;
+    if (const auto error = co_await receive_exact(proactor, handle, prefix, deadline); error)
+        co_return sfap::unexpected<sfap::error_code>(error);
+
+    sfap::Buffer message{read16(prefix, 0)};
+    if (!message.resize(read16(prefix, 0)))
+        co_return sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+    if (const auto error = co_await receive_exact(proactor, handle, message, deadline); error)
+        co_return sfap::unexpected<sfap::error_code>(error);
+
+    auto response = sfap::net::dns::decode_response(message.view(), name);
+    if (response && (response->id != query.id || response->type != query.type))
+        co_return sfap::net::dns::error(sfap::net::dns::errc::MALFORMED);
+    co_return response;
+}
+
+/*!
+  \brief Ask \p server for every type in \p types at once.
+  \details All queries are sent before any answer is read. Answers that do
+           not match an outstanding query are dropped. Unless \p all is set,
+           returns as soon as the first (preferred) type has an address.
+*/
+sfap::task<sfap::result<Answers>> exchange(Proactor& proactor, const sfap::net::Address& server,
+                                           std::string_view name, std::span<const Type> types,
+                                           Proactor::duration timeout, bool all) noexcept {
+    const auto deadline{Proactor::clock::now() + timeout};
+
+    const auto socket = proactor.connect_datagram(server);
+    if (!socket)
+        co_return sfap::unexpected<sfap::error_code>(socket.error());
+    const sfap::net::socket_t handle{socket->get_handle()};
+
+    std::array<Query, 2> queries;
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        Query& query{queries[i]};
+        query.type = types[i];
+        query.id = next_query_id();
+        const auto size = sfap::net::dns::encode_query(query.message, query.id, name, query.type);
+        if (!size)
+            co_return sfap::unexpected<sfap::error_code>(size.error());
+        query.size = *size;
+
+        const auto sent = co_await proactor.socket_send(handle, query.bytes());
+        if (!sent)
+            co_return sfap::unexpected<sfap::error_code>(sent.error());
+    }
+
+    Answers answers;
+    std::array<std::byte, sfap::net::dns::max_udp_message> buffer;
+    const auto preferred_found = [&answers] { return answers[0] && !answers[0]->addresses.empty(); };
+    for (std::size_t pending = types.size(); pending != 0 && (all || !preferred_found());) {
+        const auto left{deadline - Proactor::clock::now()};
+        if (left <= Proactor::duration::zero())
+            co_return sfap::net::dns::error(sfap::net::dns::errc::TIMEOUT);
+
+        const auto received = co_await proactor.socket_recv_for(handle, buffer, left);
+        if (!received) {
+            if (is_timeout(received.error()))
+                co_return sfap::net::dns::error(sfap::net::dns::errc::TIMEOUT);
+            co_return sfap::unexpected<sfap::error_code>(received.error());
+        }
+
+        auto response = sfap::net::dns::decode_response({buffer.data(), *received}, name);
+        if (!response)
+            continue;
+
+        std::size_t i{};
+        while (i < types.size() && (queries[i].id != response->id || queries[i].type != response->type || answers[i]))
+            ++i;
+        if (i == types.size())
+            continue;
+
+        if (response->truncated) {
+            response = co_await exchange_tcp(proactor, server, queries[i], name, deadline);
+            if (!response)
+                co_return sfap::unexpected<sfap::error_code>(response.error());
+        }
+
+        auto outcome = classify(*response);
+        if (!outcome)
+            co_return sfap::unexpected<sfap::error_code>(outcome.error());
+        answers[i] = std::move(*outcome);
+        --pending;
+    }
+
+    co_return answers;
+}
+
+bool append(sfap::net::AddressList& list, const std::optional<ipx_t>& ip) noexcept {
+    return !ip || list.push_back(*ip);
+}
+
+/*!
+  \brief Addresses of \p host, preferred family first.
+  \param all Wait for every asked family instead of stopping at the first preferred address.
+*/
+sfap::task<sfap::result<sfap::net::AddressList>> lookup(Proactor& proactor, std::string_view host, ResolveMode mode,
+                                                        const sfap::net::dns::Config& config, bool all) noexcept {
+    namespace dns = sfap::net::dns;
+    sfap::net::AddressList list;
+
+    if (const auto ip = sfap::net::parse_ip(host)) {
+        if ((mode == ResolveMode::REQUIRE_IPV4 && !ip->is_4()) || (mode == ResolveMode::REQUIRE_IPV6 && !ip->is_6()))
+            co_return sfap::generic_error(sfap::errc::INVALID_ARGUMENT);
+        list.push_back(*ip);
+        co_return list;
+    }
+
+    std::array<std::byte, dns::max_udp_message> scratch;
+    if (!dns::encode_query(scratch, 0, host, Type::A))
+        co_return sfap::generic_error(sfap::errc::INVALID_ARGUMENT);
+
+    // The preferred family goes first; "require" modes ask for one family only.
+    const bool v6_first{mode == ResolveMode::REQUIRE_IPV6 || mode == ResolveMode::PREFER_IPV6};
+    const std::array<Type, 2> types{v6_first ? Type::AAAA : Type::A, v6_first ? Type::A : Type::AAAA};
+    const std::span<const Type> asked{types.data(),
+                                      mode == ResolveMode::REQUIRE_IPV4 || mode == ResolveMode::REQUIRE_IPV6 ? 1u : 2u};
+
+    for (const Type type : asked) {
+        const auto mode_for_type{type == Type::A ? ResolveMode::REQUIRE_IPV4 : ResolveMode::REQUIRE_IPV6};
+        append(list, config.hosts.find(host, mode_for_type));
+    }
+    if (!list.empty())
+        co_return list;
+    if (config.servers().empty())
+        co_return dns::error(dns::errc::NO_SERVERS);
+
+    dns::errc failure{dns::errc::NAME_ERROR};
+    for (const Name& candidate : config.candidates(host)) {
+        const std::string_view name{candidate.view()};
+        std::optional<Answers> answers;
+        sfap::error_code last{dns::error(dns::errc::TIMEOUT).error()};
+
+        for (unsigned attempt = 0; attempt < std::max(config.attempts, 1u) && !answers; ++attempt) {
+            for (const sfap::net::Address& server : config.servers()) {
+                auto exchanged = co_await exchange(proactor, server, name, asked, config.timeout, all);
+                if (exchanged) {
+                    answers = std::move(*exchanged);
+                    break;
+                }
+                last = exchanged.error();
+            }
+        }
+        if (!answers)
+            co_return sfap::unexpected<sfap::error_code>(last);
+
+        for (const auto& outcome : *answers) {
+            if (!outcome)
+                continue;
+            for (const ipx_t& ip : outcome->addresses)
+                if (!list.push_back(ip))
+                    co_return sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+            if (outcome->exists)
+                failure = dns::errc::NO_DATA;
+        }
+        if (!list.empty())
+            co_return list;
+    }
+
+    co_return dns::error(failure);
+}
+
+} // namespace
+
+sfap::unexpected<sfap::error_code> sfap::net::dns::error(errc code) noexcept {
+    static const dns_category category;
+    return sfap::unexpected<sfap::error_code>({static_cast<int>(code), category});
+}
+
+sfap::result<std::size_t> sfap::net::dns::encode_query(std::span<std::byte> out, std::uint16_t id,
+                                                       std::string_view name, Type type) noexcept {
+    name = strip_root(name);
+    if (name.empty() || name.size() > max_name_size || out.size() < header_size + name.size() + 2 + 4)
+        return generic_error(sfap::errc::INVALID_ARGUMENT);
+
+    std::fill_n(out.begin(), header_size, std::byte{0});
+    write16(&out[0], id);
+    write16(&out[2], flag_recursion_desired);
+    write16(&out[4], 1);
+
+    std::size_t at{header_size};
+    while (!name.empty()) {
+        const std::size_t length{std::min(name.find('.'), name.size())};
+        if (length == 0 || length > 63)
+            return generic_error(sfap::errc::INVALID_ARGUMENT);
+
+        out[at++] = static_cast<std::byte>(length);
+        for (std::size_t i = 0; i < length; ++i)
+            out[at++] = static_cast<std::byte>(name[i]);
+        name.remove_prefix(std::min(length + 1, name.size()));
+    }
+    out[at++] = std::byte{0};
+
+    write16(&out[at], static_cast<std::uint16_t>(type));
+    write16(&out[at + 2], class_in);
+    return at + 4;
+}
+
+sfap::result<sfap::net::dns::Response> sfap::net::dns::decode_response(std::span<const std::byte> message,
+                                                                       std::string_view name) noexcept {
+    if (message.size() < header_size)
+        return error(errc::MALFORMED);
+
+    const std::uint16_t flags{read16(message, 2)};
+    if ((flags & flag_response) == 0 || read16(message, 4) != 1)
+        return error(errc::MALFORMED);
+
+    Response response;
+    response.id = read16(message, 0);
+    response.rcode = static_cast<std::uint8_t>(flags & 0x000F);
+    response.truncated = (flags & flag_truncated) != 0;
+
+    Name owner;
+    std::size_t at{header_size};
+    if (!read_name(message, at, owner, at) || at + 4 > message.size())
+        return error(errc::MALFORMED);
+
+    name = strip_root(name);
+    if (owner.size != name.size() || !std::equal(name.begin(), name.end(), owner.chars.begin(),
+                                                  [](char a, char b) { return lower(a) == b; }))
+        return error(errc::MALFORMED);
+
+    const std::uint16_t qtype{read16(message, at)};
+    if ((qtype != static_cast<std::uint16_t>(Type::A) && qtype != static_cast<std::uint16_t>(Type::AAAA)) ||
+        read16(message, at + 2) != class_in)
+        return error(errc::MALFORMED);
+    response.type = static_cast<Type>(qtype);
+    at += 4;
+
+    const std::size_t width{response.type == Type::A ? 4u : 16u};
+    bool first{true};
+    for (std::uint16_t answers = read16(message, 6); answers != 0; --answers) {
+        // A truncated answer section keeps what was complete.
+        if (!read_name(message, at, owner, at) || at + 10 > message.size())
+            return response.truncated ? sfap::result<Response>{response} : error(errc::MALFORMED);
+
+        const std::uint16_t type{read16(message, at)};
+        const std::uint16_t klass{read16(message, at + 2)};
+        const std::uint32_t ttl{read32(message, at + 4)};
+        const std::size_t length{read16(message, at + 8)};
+        at += 10;
+        if (at + length > message.size())
+            return response.truncated ? sfap::result<Response>{response} : error(errc::MALFORMED);
+
+        if (type == qtype && klass == class_in && length == width && response.count < Response::max_addresses) {
+            if (response.type == Type::A) {
+                ip4_t ip;
+                for (std::size_t i = 0; i < ip.size(); ++i)
+                    ip[i] = std::to_integer<std::uint8_t>(message[at + i]);
+                response.addresses[response.count++] = ipx_t{ip};
+            } else {
+                ip6_t ip;
+                for (std::size_t i = 0; i < ip.size(); ++i)
+                    ip[i] = std::to_integer<std::uint8_t>(message[at + i]);
+                response.addresses[response.count++] = ipx_t{ip};
+            }
+            response.ttl = first ? ttl : std::min(response.ttl, ttl);
+            first = false;
+        }
+        at += length;
+    }
+
+    return response;
+}
+
+bool sfap::net::dns::Name::assign(std::initializer_list<std::string_view> parts) noexcept {
+    std::size_t total{};
+    for (const std::string_view part : parts)
+        total += part.size();
+    if (total > max_name_size)
+        return false;
+
+    size = 0;
+    for (const std::string_view part : parts)
+        size = static_cast<std::size_t>(std::copy(part.begin(), part.end(), chars.begin() + size) - chars.begin());
+    return true;
+}
+
+sfap::net::dns::Hosts::~Hosts() noexcept {
+    clear();
+}
+
+sfap::net::dns::Hosts::Hosts(Hosts&& other) noexcept
+    : entries_(std::exchange(other.entries_, nullptr)), mask_(std::exchange(other.mask_, 0)),
+      size_(std::exchange(other.size_, 0)) {}
+
+sfap::net::dns::Hosts& sfap::net::dns::Hosts::operator=(Hosts&& other) noexcept {
+    if (this != &other) {
+        clear();
+        entries_ = std::exchange(other.entries_, nullptr);
+        mask_ = std::exchange(other.mask_, 0);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+sfap::error_code sfap::net::dns::Hosts::parse(std::string_view text) noexcept {
+    sfap::error_code error{sfap::no_error()};
+    for_each_line(text, '#', [this, &error](std::span<const std::string_view> fields) {
+        const auto ip = parse_ip(fields[0]);
+        if (!ip || error)
+            return;
+
+        for (const std::string_view field : fields.subspan(1)) {
+            Name name;
+            if (!lowercase(strip_root(field), name) || name.size == 0)
+                continue;
+
+            if (!reserve()) {
+                error = sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY).error();
+                return;
+            }
+            Entry& entry{slot(name.view())};
+            if (!entry.name) {
+                entry.name = new (std::nothrow) char[name.size];
+                if (!entry.name) {
+                    error = sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY).error();
+                    return;
+                }
+                std::copy_n(name.chars.begin(), name.size, entry.name);
+                entry.size = name.size;
+                ++size_;
+            }
+
+            std::optional<ipx_t>& address{ip->is_4() ? entry.v4 : entry.v6};
+            if (!address)
+                address = *ip;
+        }
+    });
+    return error;
+}
+
+std::optional<sfap::net::ipx_t> sfap::net::dns::Hosts::find(std::string_view name, ResolveMode mode) const noexcept {
+    Name key;
+    if (size_ == 0 || !lowercase(strip_root(name), key))
+        return std::nullopt;
+
+    const Entry& entry{slot(key.view())};
+    if (!entry.name)
+        return std::nullopt;
+    return pick(mode, entry.v4, entry.v6);
+}
+
+std::size_t sfap::net::dns::Hosts::size() const noexcept {
+    return size_;
+}
+
+sfap::net::dns::Hosts::Entry& sfap::net::dns::Hosts::slot(std::string_view name) const noexcept {
+    for (std::size_t i = std::hash<std::string_view>{}(name) & mask_;; i = (i + 1) & mask_) {
+        Entry& entry{entries_[i]};
+        if (!entry.name || std::string_view{entry.name, entry.size} == name)
+            return entry;
+    }
+}
+
+bool sfap::net::dns::Hosts::reserve() noexcept {
+    const std::size_t capacity{entries_ ? mask_ + 1 : 0};
+    if ((size_ + 1) * 2 <= capacity)
+        return true;
+
+    const std::size_t grown{capacity ? capacity * 2 : 16};
+    Entry* table{new (std::nothrow) Entry[grown]};
+    if (!table)
+        return false;
+
+    Entry* old{std::exchange(entries_, table)};
+    mask_ = grown - 1;
+    for (std::size_t i = 0; i < capacity; ++i)
+        if (old[i].name)
+            slot({old[i].name, old[i].size}) = old[i];
+    delete[] old;
+    return true;
+}
+
+void sfap::net::dns::Hosts::clear() noexcept {
+    if (entries_)
+        for (std::size_t i = 0; i <= mask_; ++i)
+            delete[] entries_[i].name;
+    delete[] std::exchange(entries_, nullptr);
+    mask_ = 0;
+    size_ = 0;
+}
+
+bool sfap::net::dns::Config::add_nameserver(const Address& server) noexcept {
+    if (nameserver_count == max_nameservers)
+        return false;
+    nameservers[nameserver_count++] = server;
+    return true;
+}
+
+bool sfap::net::dns::Config::add_search(std::string_view domain) noexcept {
+    if (search_count == max_search || !search[search_count].assign({strip_root(domain)}))
+        return false;
+    ++search_count;
+    return true;
+}
+
+void sfap::net::dns::Config::parse_resolv_conf(std::string_view text) noexcept {
+    for_each_line(text, ';', [this](std::span<const std::string_view> fields) {
+        const std::string_view keyword{fields[0]};
+        const auto arguments{fields.subspan(1)};
+
+        if (keyword == "nameserver" && arguments.size() == 1) {
+            // Past the limit, further name servers are ignored like glibc does.
+            if (const auto ip = parse_ip(arguments[0]))
+                add_nameserver(Address{*ip, port});
+        } else if ((keyword == "search" || keyword == "domain") && !arguments.empty()) {
+            // The last of "search" and "domain" wins.
+            search_count = 0;
+            for (const std::string_view domain : keyword == "domain" ? arguments.first(1) : arguments)
+                if (strip_root(domain).size() != 0)
+                    add_search(domain);
+        } else if (keyword == "options") {
+            for (const std::string_view option : arguments) {
+                if (const auto value = option_value(option, "ndots:", 15))
+                    ndots = *value;
+                else if (const auto value = option_value(option, "timeout:", 30))
+                    timeout = std::chrono::seconds{std::max(*value, 1u)};
+                else if (const auto value = option_value(option, "attempts:", 5))
+                    attempts = std::max(*value, 1u);
+            }
+        }
+    });
+
+    if (nameserver_count == 0)
+        add_nameserver(Address{ipx_t{ip4_t{127, 0, 0, 1}}, port});
+}
+
+sfap::net::dns::Config::Candidates sfap::net::dns::Config::candidates(std::string_view name) const noexcept {
+    Candidates names;
+    const auto add = [&names](std::initializer_list<std::string_view> parts) noexcept {
+        if (names.names[names.count].assign(parts))
+            ++names.count;
+    };
+
+    if (name.ends_with('.')) {
+        add({strip_root(name)});
+        return names;
+    }
+
+    const auto dots{static_cast<unsigned>(std::count(name.begin(), name.end(), '.'))};
+    if (dots >= ndots)
+        add({name});
+    for (const Name& domain : domains())
+        add({name, ".", domain.view()});
+    if (dots < ndots)
+        add({name});
+    return names;
+}
+
+sfap::result<sfap::net::dns::Config> sfap::net::dns::Config::load(const char* resolv_conf,
+                                                                  const char* hosts) noexcept {
+    Config config;
+    Buffer text{growable};
+    if (resolv_conf && !read_file(resolv_conf, text))
+        return generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+    config.parse_resolv_conf(as_text(text));
+
+    text.clean();
+    if (hosts) {
+        if (!read_file(hosts, text))
+            return generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+        if (const auto error = config.hosts.parse(as_text(text)); error)
+            return unexpected<error_code>(error);
+    }
+    return config;
+}
+
+const sfap::net::dns::Config& sfap::net::dns::Config::system() noexcept {
+    static const Config config{[]() noexcept {
+        auto loaded = load();
+        if (loaded)
+            return std::move(*loaded);
+        Config fallback;
+        fallback.parse_resolv_conf({});
+        return fallback;
+    }()};
+    return config;
+}
+
+sfap::task<sfap::result<sfap::net::ipx_t>> sfap::net::Proactor::resolve(std::string_view host,
+                                                                        ResolveMode mode) noexcept {
+    co_return co_await resolve(host, mode, dns::Config::system());
+}
+
+sfap::task<sfap::result<sfap::net::ipx_t>>
+sfap::net::Proactor::resolve(std::string_view host, ResolveMode mode, const dns::Config& config) noexcept {
+    const auto list = co_await lookup(*this, host, mode, config, false);
+    if (!list)
+        co_return unexpected<error_code>(list.error());
+    co_return (*list)[0];
+}
+
+sfap::task<sfap::result<sfap::net::AddressList>> sfap::net::Proactor::resolve_all(std::string_view host,
+                                                                                  ResolveMode mode) noexcept {
+    co_return co_await resolve_all(host, mode, dns::Config::system());
+}
+
+sfap::task<sfap::result<sfap::net::AddressList>>
+sfap::net::Proactor::resolve_all(std::string_view host, ResolveMode mode, const dns::Config& config) noexcept {
+    co_return co_await lookup(*this, host, mode, config, true);
+}
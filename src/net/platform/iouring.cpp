@@ -2,12 +2,18 @@
 
 #if defined(SUPPORTED_IOURING)
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <coroutine>
+#include <mutex>
 #include <span>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <cerrno>
 #include <cstddef>
 #include <cstring>
 
@@ -15,7 +21,9 @@
 #include <fcntl.h>
 #include <liburing.h>
 #include <netinet/in.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <sfap/error.hpp>
@@ -23,6 +31,7 @@
 #include <sfap/net/platform/iouring.hpp>
 #include <sfap/net/proactor.hpp>
 #include <sfap/net/socket.hpp>
+#include <sfap/net/socket_options.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/expected.hpp>
 #include <sfap/utils/task.hpp>
@@ -35,8 +44,14 @@ sfap::error_code sfap::net::IOUringProactor::Awaiter::get_error() const noexcept
 }
 
 sfap::net::IOUringProactor::IOUringProactor(std::size_t entries) noexcept {
-    if (const int result = io_uring_queue_init(entries, &ring_, 0); result < 0)
+    if (const int result = io_uring_queue_init(entries, &ring_, 0); result < 0) {
         last_error_ = network_error(-result).error();
+        return;
+    }
+
+    wake_fd_ = ::eventfd(0, EFD_CLOEXEC);
+    if (wake_fd_ < 0)
+        last_error_ = system_error().error();
 }
 
 sfap::net::IOUringProactor::~IOUringProactor() noexcept {
@@ -50,6 +65,9 @@ sfap::net::IOUringProactor::~IOUringProactor() noexcept {
     }
     sockets_.clear();
 
+    if (wake_fd_ >= 0)
+        ::close(wake_fd_);
+
     io_uring_queue_exit(&ring_);
 }
 
@@ -73,89 +91,163 @@ void sfap::net::IOUringProactor::free_opdata(sfap::net::IOUringProactor::Operati
 }
 
 void sfap::net::IOUringProactor::run() noexcept {
+    loop_thread_.store(std::this_thread::get_id(), std::memory_order_release);
     running_.store(true, std::memory_order_release);
 
     while (running_.load(std::memory_order_acquire)) {
+        run_ready();
+        if (!running_.load(std::memory_order_acquire))
+            break;
+
+        // Without the eventfd read in the ring nothing wakes a blocked wait,
+        // so until it can be queued, poll with a short timeout instead.
+        if (wake_fd_ >= 0 && !wake_armed_)
+            arm_wakeup();
+
         io_uring_cqe* cqe = nullptr;
-        if (const int result = io_uring_wait_cqe(&ring_, &cqe); result < 0)
+        __kernel_timespec retry{0, 1'000'000};
+        const bool poll{wake_fd_ >= 0 && !wake_armed_};
+        const int result{poll ? io_uring_wait_cqe_timeout(&ring_, &cqe, &retry) : io_uring_wait_cqe(&ring_, &cqe)};
+        if (result < 0)
             continue;
 
         handle_cqe(cqe);
         io_uring_cqe_seen(&ring_, cqe);
     }
+
+    loop_thread_.store(std::thread::id{}, std::memory_order_release);
 }
 
 void sfap::net::IOUringProactor::stop() noexcept {
     running_.store(false, std::memory_order_release);
+    wake();
+}
+
+void sfap::net::IOUringProactor::post(std::coroutine_handle<> h) noexcept {
+    if (!h)
+        return;
+
+    {
+        std::lock_guard lock{ready_mutex_};
+        ready_.push_back(h);
+    }
+
+    if (loop_thread_.load(std::memory_order_acquire) != std::this_thread::get_id())
+        wake();
+}
+
+void sfap::net::IOUringProactor::wake() noexcept {
+    if (wake_fd_ >= 0)
+        ::eventfd_write(wake_fd_, 1);
+}
+
+void sfap::net::IOUringProactor::arm_wakeup() noexcept {
+    if (wake_fd_ < 0)
+        return;
 
     io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
-    if (sqe) {
-        io_uring_prep_nop(sqe);
-        io_uring_sqe_set_data(sqe, nullptr);
+    if (!sqe) {
+        // Submission queue full: hand the queued entries to the kernel and retry.
         io_uring_submit(&ring_);
+        sqe = io_uring_get_sqe(&ring_);
     }
-}
+    wake_armed_ = sqe != nullptr;
+    if (!sqe)
+        return;
 
-sfap::task<sfap::result<sfap::net::Socket>> sfap::net::IOUringProactor::connect(const sfap::net::Address& address,
-                                                                                duration) noexcept {
-    const auto addr{address.get_address()};
-    const int family{addr->ip_.is_4() ? AF_INET : AF_INET6};
-    const int fd = ::socket(family, SOCK_STREAM | SOCK_NONBLOCK, 0);
-    if (fd < 0)
-        co_return network_error();
+    io_uring_prep_read(sqe, wake_fd_, &wake_value_, sizeof(wake_value_), 0);
+    io_uring_sqe_set_data(sqe, &wake_value_);
+    io_uring_submit(&ring_);
+}
 
-    sockaddr_storage ss{};
-    const socket_t sid = next_handle_id_++;
+void sfap::net::IOUringProactor::run_ready() noexcept {
+    std::vector<std::coroutine_handle<>> batch;
 
-    {
-        ss.ss_family = family;
-        void* destination;
-        if (family == AF_INET) {
-            auto* ipv4 = reinterpret_cast<sockaddr_in*>(&ss);
-            destination = &ipv4->sin_addr;
-            ipv4->sin_port = ::htons(addr->port_);
-        } else {
-            auto* ipv6 = reinterpret_cast<sockaddr_in6*>(&ss);
-            destination = &ipv6->sin6_addr;
-            ipv6->sin6_port = ::htons(addr->port_);
+    for (;;) {
+        {
+            std::lock_guard lock{ready_mutex_};
+            if (ready_.empty())
+                return;
+            batch.swap(ready_);
         }
 
-        std::memcpy(destination, addr->ip_.data(), addr->ip_.size());
+        for (const auto h : batch)
+            h.resume();
+        batch.clear();
+    }
+}
+
+bool sfap::net::IOUringProactor::link_timeout(io_uring_sqe* sqe, __kernel_timespec& ts, duration timeout) noexcept {
+    io_uring_sqe* timeout_sqe{io_uring_get_sqe(&ring_)};
+    if (!timeout_sqe) {
+        io_uring_prep_nop(sqe);
+        io_uring_sqe_set_data(sqe, nullptr);
+        return false;
+    }
+
+    const auto ns{std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(timeout, duration::zero())).count()};
+    ts.tv_sec = static_cast<time_t>(ns / 1'000'000'000);
+    ts.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+
+    io_uring_sqe_set_flags(sqe, IOSQE_IO_LINK);
+    io_uring_prep_link_timeout(timeout_sqe, &ts, 0);
+    io_uring_sqe_set_data(timeout_sqe, nullptr);
+    return true;
+}
+
+sfap::result<sfap::net::Socket> sfap::net::IOUringProactor::open_stream(const sfap::net::Address& peer,
+                                                                       const SocketOptions& options) noexcept {
+    const ::sockaddr* target{peer.socket_address()};
+    if (!target)
+        return generic_error(errc::INVALID_ARGUMENT);
+
+    const int fd = ::socket(target->sa_family, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (fd < 0)
+        return network_error();
+
+    if (const auto error = apply_socket_options(fd, options)) {
+        ::close(fd);
+        return sfap::unexpected<error_code>(error);
     }
 
+    const socket_t sid = next_handle_id_++;
     sockets_.emplace(sid, SocketState{fd, false});
+    return Socket{this, sid};
+}
 
+sfap::task<sfap::error_code> sfap::net::IOUringProactor::socket_connect(sfap::net::socket_t sid,
+                                                                       const sfap::net::Address& address,
+                                                                       duration timeout) noexcept {
     class ConnectAwaiter final : public Awaiter {
 
       public:
-        explicit ConnectAwaiter(IOUringProactor& self_, socket_t socket_, sockaddr_storage* ss)
-            : Awaiter(self_, socket_), address(ss) {}
+        explicit ConnectAwaiter(IOUringProactor& self_, socket_t socket_, const Address& address, duration timeout)
+            : Awaiter(self_, socket_), address_(address), timeout_(timeout) {}
 
         bool await_ready() const noexcept {
             return false;
         }
 
-        void await_suspend(std::coroutine_handle<> h) noexcept {
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
             const auto it{self_.sockets_.find(socket_)};
             if (it == self_.sockets_.end()) {
-                error_ = network_error().error();
-                h.resume();
-                return;
+                error_ = generic_error(errc::INVALID_ARGUMENT).error();
+                return false;
             }
 
             const int fd{it->second.handle};
             io_uring_sqe* sqe{io_uring_get_sqe(&self_.ring_)};
             if (!sqe) {
                 error_ = network_error().error();
-                h.resume();
-                return;
+                return false;
             }
 
             const auto alloc_result{self_.alloc_opdata()};
             if (!alloc_result) {
+                io_uring_prep_nop(sqe);
+                io_uring_sqe_set_data(sqe, nullptr);
                 error_ = alloc_result.error();
-                h.resume();
-                return;
+                return false;
             }
 
             operation_ = *alloc_result;
@@ -164,55 +256,85 @@ sfap::task<sfap::result<sfap::net::Socket>> sfap::net::IOUringProactor::connect(
             operation_->handle = socket_;
             operation_->coro = h;
 
-            io_uring_prep_connect(sqe, fd, reinterpret_cast<const sockaddr*>(address),
-                                  address->ss_family == AF_INET ? sizeof(sockaddr_in) : sizeof(sockaddr_in6));
+            io_uring_prep_connect(sqe, fd, address_.socket_address(), address_.socket_address_size());
             io_uring_sqe_set_data(sqe, operation_);
 
+            if (timeout_ != duration::max() && !self_.link_timeout(sqe, ts_, timeout_)) {
+                self_.free_opdata(operation_);
+                error_ = network_error(EBUSY).error();
+                return false;
+            }
+
             if (const int result = io_uring_submit(&self_.ring_); result < 0) {
                 self_.free_opdata(operation_);
                 error_ = network_error(-result).error();
-                h.resume();
+                return false;
             }
+            return true;
         }
 
-        result<Socket> await_resume() noexcept {
-            if (error_)
-                return sfap::unexpected<error_code>(error_);
-            return Socket{&self_, socket_};
+        error_code await_resume() noexcept {
+            return error_;
         }
 
         void on_complete(int result) noexcept override {
-            if (result < 0)
+            if (result == -ECANCELED && timeout_ != duration::max())
+                error_ = network_error(ETIMEDOUT).error();
+            else if (result < 0)
                 error_ = network_error(-result).error();
             else
                 error_ = no_error();
         }
 
       private:
-        sockaddr_storage* address;
+        const Address& address_;
+        duration timeout_;
+        __kernel_timespec ts_{};
     };
 
-    ConnectAwaiter aw(*this, sid, &ss);
-    auto result = co_await aw;
+    if (!address.socket_address())
+        co_return generic_error(errc::INVALID_ARGUMENT).error();
 
-    const auto cleanup = [this, sid]() {
-        const auto it = sockets_.find(sid);
-        if (it != sockets_.end()) {
-            if (it->second.handle >= 0)
-                ::close(it->second.handle);
-            sockets_.erase(it);
-        }
-    };
+    ConnectAwaiter aw(*this, sid, address, timeout);
+    co_return co_await aw;
+}
 
-    if (!result) {
-        cleanup();
-        co_return sfap::unexpected<error_code>(result.error());
-    }
+sfap::task<sfap::result<sfap::net::Socket>>
+sfap::net::IOUringProactor::connect(const sfap::net::Address& address, duration timeout,
+                                    const SocketOptions& options) noexcept {
+    auto socket = open_stream(address, options);
+    if (!socket)
+        co_return sfap::unexpected<error_code>(socket.error());
+
+    // Closing the Socket on failure releases the descriptor and its entry.
+    if (const auto error = co_await socket_connect(socket->get_handle(), address, timeout))
+        co_return sfap::unexpected<error_code>(error);
+
+    co_return std::move(socket);
+}
+
+void sfap::net::IOUringProactor::cancel(sfap::net::socket_t sid) noexcept {
+    const auto it = sockets_.find(sid);
+    if (it == sockets_.end() || it->second.handle < 0)
+        return;
+
+    io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+    if (!sqe)
+        return;
+
+    io_uring_prep_cancel_fd(sqe, it->second.handle, IORING_ASYNC_CANCEL_ALL);
+    io_uring_sqe_set_data(sqe, nullptr);
+    io_uring_submit(&ring_);
+}
 
-    if (!result->is_valid())
-        cleanup();
+bool sfap::net::IOUringProactor::socket_alive(sfap::net::socket_t sid) noexcept {
+    const auto it = sockets_.find(sid);
+    if (it == sockets_.end() || it->second.handle < 0)
+        return false;
 
-    co_return result;
+    std::byte probe;
+    const ssize_t n = ::recv(it->second.handle, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
 }
 
 void sfap::net::IOUringProactor::close(sfap::net::socket_t handle) noexcept {
@@ -242,19 +364,17 @@ sfap::task<sfap::error_code> sfap::net::IOUringProactor::sleep_for(sfap::net::Pr
             return false;
         }
 
-        void await_suspend(std::coroutine_handle<> h) noexcept {
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
             io_uring_sqe* sqe = io_uring_get_sqe(&self_.ring_);
             if (!sqe) {
                 error_ = network_error().error();
-                h.resume();
-                return;
+                return false;
             }
 
             const auto alloc_result{self_.alloc_opdata()};
             if (!alloc_result) {
                 error_ = alloc_result.error();
-                h.resume();
-                return;
+                return false;
             }
 
             operation_ = *alloc_result;
@@ -273,8 +393,9 @@ sfap::task<sfap::error_code> sfap::net::IOUringProactor::sleep_for(sfap::net::Pr
             if (const int result = io_uring_submit(&self_.ring_); result < 0) {
                 self_.free_opdata(operation_);
                 error_ = network_error(-result).error();
-                h.resume();
+                return false;
             }
+            return true;
         }
 
         void on_complete(int) noexcept override {
@@ -303,25 +424,22 @@ sfap::net::IOUringProactor::socket_send(socket_t sid, std::span<const std::byte>
             return data_.empty();
         }
 
-        void await_suspend(std::coroutine_handle<> h) noexcept {
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
             const auto it = self_.sockets_.find(socket_);
             if (it == self_.sockets_.end() || data_.empty()) {
-                h.resume();
-                return;
+                return false;
             }
 
             const int handle = it->second.handle;
             io_uring_sqe* sqe = io_uring_get_sqe(&self_.ring_);
             if (!sqe) {
-                h.resume();
-                return;
+                return false;
             }
 
             const auto alloc_result{self_.alloc_opdata()};
             if (!alloc_result) {
                 error_ = alloc_result.error();
-                h.resume();
-                return;
+                return false;
             }
 
             operation_ = *alloc_result;
@@ -336,8 +454,9 @@ sfap::net::IOUringProactor::socket_send(socket_t sid, std::span<const std::byte>
             if (const int result = io_uring_submit(&self_.ring_); result < 0) {
                 self_.free_opdata(operation_);
                 error_ = network_error(-result).error();
-                h.resume();
+                return false;
             }
+            return true;
         }
 
         result<std::size_t> await_resume() noexcept {
@@ -365,6 +484,97 @@ sfap::net::IOUringProactor::socket_send(socket_t sid, std::span<const std::byte>
     co_return co_await aw;
 }
 
+sfap::task<sfap::result<std::size_t>>
+sfap::net::IOUringProactor::socket_sendv(socket_t sid, std::span<const std::span<const std::byte>> data) noexcept {
+    struct SendvAwaiter final : public Awaiter {
+      public:
+        explicit SendvAwaiter(IOUringProactor& self, socket_t socket,
+                              std::span<const std::span<const std::byte>> data) noexcept
+            : Awaiter(self, socket), data_(data) {}
+
+        ~SendvAwaiter() noexcept override {
+            delete[] iov_;
+        }
+
+        bool await_ready() const noexcept {
+            return data_.empty();
+        }
+
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
+            const auto it = self_.sockets_.find(socket_);
+            if (it == self_.sockets_.end() || data_.empty()) {
+                return false;
+            }
+
+            iov_ = new (std::nothrow) iovec[data_.size()];
+            if (!iov_) {
+                error_ = generic_error(errc::NOT_ENOUGH_MEMORY).error();
+                return false;
+            }
+            for (std::size_t i = 0; i < data_.size(); ++i)
+                iov_[i] = {const_cast<std::byte*>(data_[i].data()), data_[i].size()};
+            msg_.msg_iov = iov_;
+            msg_.msg_iovlen = data_.size();
+
+            const int handle = it->second.handle;
+            io_uring_sqe* sqe = io_uring_get_sqe(&self_.ring_);
+            if (!sqe) {
+                error_ = network_error(EBUSY).error();
+                return false;
+            }
+
+            const auto alloc_result{self_.alloc_opdata()};
+            if (!alloc_result) {
+                io_uring_prep_nop(sqe);
+                io_uring_sqe_set_data(sqe, nullptr);
+                error_ = alloc_result.error();
+                return false;
+            }
+
+            operation_ = *alloc_result;
+            operation_->awaiter = this;
+            operation_->type = OperationType::SEND;
+            operation_->handle = socket_;
+            operation_->coro = h;
+
+            io_uring_prep_sendmsg(sqe, handle, &msg_, 0);
+            io_uring_sqe_set_data(sqe, operation_);
+
+            if (const int result = io_uring_submit(&self_.ring_); result < 0) {
+                self_.free_opdata(operation_);
+                error_ = network_error(-result).error();
+                return false;
+            }
+            return true;
+        }
+
+        result<std::size_t> await_resume() noexcept {
+            if (error_)
+                return sfap::unexpected<error_code>(error_);
+            return bytes_;
+        }
+
+        void on_complete(int result) noexcept override {
+            if (result < 0) {
+                error_ = network_error(-result).error();
+                bytes_ = 0;
+            } else {
+                error_ = no_error();
+                bytes_ = static_cast<std::size_t>(result);
+            }
+        }
+
+      private:
+        std::span<const std::span<const std::byte>> data_;
+        iovec* iov_{};
+        msghdr msg_{};
+        std::size_t bytes_{};
+    };
+
+    SendvAwaiter aw{*this, sid, data};
+    co_return co_await aw;
+}
+
 sfap::task<sfap::result<std::size_t>> sfap::net::IOUringProactor::socket_recv(socket_t sid,
                                                                               std::span<std::byte> data) noexcept {
     struct RecvAwaiter final : public Awaiter {
@@ -379,25 +589,22 @@ sfap::task<sfap::result<std::size_t>> sfap::net::IOUringProactor::socket_recv(so
             return data_.empty();
         }
 
-        void await_suspend(std::coroutine_handle<> h) noexcept {
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
             const auto it = self_.sockets_.find(socket_);
             if (it == self_.sockets_.end() || data_.empty()) {
-                h.resume();
-                return;
+                return false;
             }
 
             const int handle = it->second.handle;
             io_uring_sqe* sqe = io_uring_get_sqe(&self_.ring_);
             if (!sqe) {
-                h.resume();
-                return;
+                return false;
             }
 
             const auto alloc_result{self_.alloc_opdata()};
             if (!alloc_result) {
                 error_ = alloc_result.error();
-                h.resume();
-                return;
+                return false;
             }
 
             operation_ = *alloc_result;
@@ -412,8 +619,9 @@ sfap::task<sfap::result<std::size_t>> sfap::net::IOUringProactor::socket_recv(so
             if (const int result = io_uring_submit(&self_.ring_); result < 0) {
                 self_.free_opdata(operation_);
                 error_ = network_error(-result).error();
-                h.resume();
+                return false;
             }
+            return true;
         }
 
         result<std::size_t> await_resume() noexcept {
@@ -437,8 +645,121 @@ sfap::task<sfap::result<std::size_t>> sfap::net::IOUringProactor::socket_recv(so
     co_return co_await aw;
 }
 
+sfap::result<sfap::net::Socket> sfap::net::IOUringProactor::connect_datagram(const Address& peer) noexcept {
+    const ::sockaddr* target{peer.socket_address()};
+    if (!target)
+        return generic_error(errc::INVALID_ARGUMENT);
+
+    const int fd{::socket(target->sa_family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+    if (fd < 0)
+        return network_error();
+
+    if (::connect(fd, target, peer.socket_address_size()) != 0) {
+        const auto error{network_error()};
+        ::close(fd);
+        return error;
+    }
+
+    const socket_t sid{next_handle_id_++};
+    sockets_.emplace(sid, SocketState{fd, false});
+    return Socket{this, sid};
+}
+
+sfap::task<sfap::result<std::size_t>>
+sfap::net::IOUringProactor::socket_recv_for(socket_t sid, std::span<std::byte> data, duration timeout) noexcept {
+    if (timeout <= duration::zero())
+        co_return network_error(ETIMEDOUT);
+
+    struct TimedRecvAwaiter final : public Awaiter {
+      public:
+        explicit TimedRecvAwaiter(IOUringProactor& self, socket_t socket, std::span<std::byte> data,
+                                  duration timeout) noexcept
+            : Awaiter(self, socket), data_(data), timeout_(timeout) {}
+
+        bool await_ready() const noexcept {
+            return data_.empty();
+        }
+
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
+            const auto it = self_.sockets_.find(socket_);
+            if (it == self_.sockets_.end()) {
+                error_ = generic_error(errc::INVALID_ARGUMENT).error();
+                return false;
+            }
+
+            io_uring_sqe* sqe = io_uring_get_sqe(&self_.ring_);
+            if (!sqe) {
+                error_ = network_error(EBUSY).error();
+                return false;
+            }
+
+            const auto alloc_result{self_.alloc_opdata()};
+            if (!alloc_result) {
+                io_uring_prep_nop(sqe);
+                io_uring_sqe_set_data(sqe, nullptr);
+                error_ = alloc_result.error();
+                return false;
+            }
+
+            operation_ = *alloc_result;
+            operation_->awaiter = this;
+            operation_->type = OperationType::RECV;
+            operation_->handle = socket_;
+            operation_->coro = h;
+
+            io_uring_prep_recv(sqe, it->second.handle, data_.data(), data_.size(), 0);
+            io_uring_sqe_set_data(sqe, operation_);
+
+            if (!self_.link_timeout(sqe, ts_, timeout_)) {
+                self_.free_opdata(operation_);
+                error_ = network_error(EBUSY).error();
+                return false;
+            }
+
+            if (const int result = io_uring_submit(&self_.ring_); result < 0) {
+                self_.free_opdata(operation_);
+                error_ = network_error(-result).error();
+                return false;
+            }
+            return true;
+        }
+
+        result<std::size_t> await_resume() noexcept {
+            if (error_)
+                return sfap::unexpected<error_code>(error_);
+            return bytes_;
+        }
+
+        void on_complete(int result) noexcept override {
+            if (result == -ECANCELED) {
+                error_ = network_error(ETIMEDOUT).error();
+            } else if (result < 0) {
+                error_ = network_error(-result).error();
+            } else {
+                error_ = no_error();
+                bytes_ = static_cast<std::size_t>(result);
+            }
+        }
+
+      private:
+        std::span<std::byte> data_;
+        duration timeout_;
+        __kernel_timespec ts_{};
+        std::size_t bytes_{};
+    };
+
+    TimedRecvAwaiter aw{*this, sid, data, timeout};
+    co_return co_await aw;
+}
+
 void sfap::net::IOUringProactor::handle_cqe(io_uring_cqe* cqe) noexcept {
-    auto* operation = static_cast<OperationData*>(io_uring_cqe_get_data(cqe));
+    void* const data{io_uring_cqe_get_data(cqe)};
+    if (data == &wake_value_) {
+        arm_wakeup();
+        return;
+    }
+
+    auto* operation = static_cast<OperationData*>(data);
     if (!operation)
         return;
 
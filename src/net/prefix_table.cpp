@@ -0,0 +1,276 @@
+/*!
+  \file
+  \brief CIDR prefix table implementation.
+
+  \details
+  Builds a leaf-pushed multibit trie with 8-bit strides and answers
+  longest-prefix match queries with one load per address byte.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <sfap/error.hpp>
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/prefix_table.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/memory.hpp>
+
+namespace {
+
+constexpr std::size_t fanout{256};
+
+/// \brief Entry bit marking a child node index; other non-zero entries are `value + 1`.
+constexpr std::uint32_t child_bit{std::uint32_t{1} << 31};
+
+constexpr std::uint32_t ip4_root{0};
+constexpr std::uint32_t ip6_root{1};
+
+static_assert(std::is_trivially_copyable_v<sfap::net::ipx_t>, "prefixes are stored as raw bytes");
+
+/// \return \p text without leading and trailing spaces and tabs.
+std::string_view trim(std::string_view text) noexcept {
+    const auto begin{text.find_first_not_of(" \t\r")};
+    if (begin == std::string_view::npos)
+        return {};
+    return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+}
+
+/// \return Decimal value of \p text, `std::nullopt` unless it is 1-10 digits fitting in 32 bits.
+std::optional<std::uint32_t> parse_decimal(std::string_view text) noexcept {
+    if (text.empty() || text.size() > 10)
+        return std::nullopt;
+    std::uint64_t value{};
+    for (const char c : text) {
+        if (c < '0' || c > '9')
+            return std::nullopt;
+        value = value * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+    if (value > std::numeric_limits<std::uint32_t>::max())
+        return std::nullopt;
+    return static_cast<std::uint32_t>(value);
+}
+
+/// \return Address and length of \p cidr, `std::nullopt` if malformed.
+std::optional<std::pair<sfap::net::ipx_t, std::uint8_t>> parse_cidr(std::string_view cidr) noexcept {
+    const auto slash{cidr.find('/')};
+    const auto address{sfap::net::parse_ip(cidr.substr(0, slash))};
+    if (!address)
+        return std::nullopt;
+
+    std::uint32_t length{static_cast<std::uint32_t>(address->size() * 8)};
+    if (slash != std::string_view::npos) {
+        const auto digits{cidr.substr(slash + 1)};
+        const auto parsed{digits.size() <= 3 ? parse_decimal(digits) : std::nullopt};
+        if (!parsed || *parsed > length)
+            return std::nullopt;
+        length = *parsed;
+    }
+    return std::pair{*address, static_cast<std::uint8_t>(length)};
+}
+
+} // namespace
+
+bool sfap::net::PrefixTable::Builder::add(const ipx_t& address, std::uint8_t length, std::uint32_t value) noexcept {
+    if (length > address.size() * 8 || value > max_value)
+        return false;
+    const Prefix prefix{address, length, value};
+    return prefixes_.append(std::as_bytes(std::span{&prefix, 1}));
+}
+
+bool sfap::net::PrefixTable::Builder::add(std::string_view cidr, std::uint32_t value) noexcept {
+    const auto prefix{parse_cidr(cidr)};
+    return prefix && add(prefix->first, prefix->second, value);
+}
+
+sfap::result<std::size_t> sfap::net::PrefixTable::Builder::add_text(std::string_view text,
+                                                                    std::uint32_t value) noexcept {
+    std::size_t added{};
+    while (!text.empty()) {
+        const auto newline{text.find('\n')};
+        std::string_view line{text.substr(0, newline)};
+        text = newline == std::string_view::npos ? std::string_view{} : text.substr(newline + 1);
+
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+
+        const auto separator{line.find_first_of(" \t")};
+        std::uint32_t line_value{value};
+        if (separator != std::string_view::npos) {
+            const auto parsed{parse_decimal(trim(line.substr(separator)))};
+            if (!parsed)
+                return generic_error(errc::INVALID_ARGUMENT);
+            line_value = *parsed;
+        }
+
+        const auto prefix{parse_cidr(line.substr(0, separator))};
+        if (!prefix || line_value > max_value)
+            return generic_error(errc::INVALID_ARGUMENT);
+        if (!add(prefix->first, prefix->second, line_value))
+            return generic_error(errc::NOT_ENOUGH_MEMORY);
+        ++added;
+    }
+    return added;
+}
+
+std::size_t sfap::net::PrefixTable::Builder::size() const noexcept {
+    return prefixes_.size() / sizeof(Prefix);
+}
+
+sfap::result<sfap::net::PrefixTable> sfap::net::PrefixTable::Builder::build() const noexcept {
+    return build(nullptr);
+}
+
+sfap::result<sfap::net::PrefixTable>
+sfap::net::PrefixTable::Builder::build(const MemoryOptions& options) const noexcept {
+    return build(&options);
+}
+
+sfap::result<sfap::net::PrefixTable>
+sfap::net::PrefixTable::Builder::build(const MemoryOptions* options) const noexcept {
+    struct Item {
+        ip6_t key; // address bytes with the bits past `length` cleared
+        std::uint8_t length;
+        bool is_4;
+        std::uint32_t entry;
+    };
+
+    const std::size_t count{size()};
+    const auto* prefixes{reinterpret_cast<const Prefix*>(prefixes_.data())};
+
+    Buffer storage{count * sizeof(Item)};
+    if (count && !storage)
+        return generic_error(errc::NOT_ENOUGH_MEMORY);
+    auto* items{reinterpret_cast<Item*>(storage.data())};
+    for (std::size_t i = 0; i < count; ++i) {
+        const Prefix& prefix{prefixes[i]};
+        Item item{{}, prefix.length, prefix.address.is_4(), prefix.value + 1};
+        std::memcpy(item.key.data(), prefix.address.data(), prefix.address.size());
+        for (std::size_t bit = prefix.length; bit < item.key.size() * 8; ++bit)
+            item.key[bit / 8] &= static_cast<std::uint8_t>(~(0x80u >> (bit % 8)));
+        items[i] = item;
+    }
+
+    // Count the nodes up front so they go straight into their final storage.
+    // Every distinct leading `level + 1` bytes of a prefix longer than that
+    // opens one node; sorted by key, prefixes sharing those bytes are
+    // adjacent. The sort is stable so equal prefixes keep their order.
+    std::stable_sort(items, items + count, [](const Item& a, const Item& b) {
+        if (a.is_4 != b.is_4)
+            return a.is_4;
+        return a.key < b.key;
+    });
+
+    std::size_t node_count{2};
+    std::array<const Item*, sizeof(ip6_t)> opened{};
+    for (std::size_t i = 0; i < count; ++i) {
+        const Item& item{items[i]};
+        for (std::size_t level = 0; (level + 1) * 8 < item.length; ++level) {
+            const Item* last{opened[level]};
+            if (!last || last->is_4 != item.is_4 || std::memcmp(last->key.data(), item.key.data(), level + 1) != 0)
+                ++node_count;
+            opened[level] = &item;
+        }
+    }
+
+    // Shorter prefixes first, so each insertion only ever overwrites entries
+    // of equal or shorter prefixes and never meets a child node in its range.
+    // Equal prefixes end up adjacent, and the stable sort keeps the last one
+    // added last, so its value wins.
+    std::stable_sort(items, items + count, [](const Item& a, const Item& b) {
+        if (a.length != b.length)
+            return a.length < b.length;
+        if (a.is_4 != b.is_4)
+            return a.is_4;
+        return a.key < b.key;
+    });
+
+    const std::size_t bytes{node_count * fanout * sizeof(std::uint32_t)};
+    PrefixTable table;
+    table.nodes_ = options ? Buffer{bytes, *options} : Buffer{bytes};
+    if (!table.nodes_)
+        return generic_error(errc::NOT_ENOUGH_MEMORY);
+
+    auto* nodes{reinterpret_cast<std::uint32_t*>(table.nodes_.data())};
+    std::fill(nodes, nodes + 2 * fanout, 0);
+    std::uint32_t next{2};
+    std::size_t distinct{};
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const Item& item{items[i]};
+
+        std::uint32_t node{item.is_4 ? ip4_root : ip6_root};
+        std::size_t level{};
+        for (std::size_t consumed = 8; item.length > consumed; consumed += 8, ++level) {
+            const std::size_t slot{node * fanout + item.key[level]};
+            if (nodes[slot] & child_bit) {
+                node = nodes[slot] & ~child_bit;
+                continue;
+            }
+            // Push the covering value down into the new child.
+            const std::uint32_t child{next++};
+            std::fill(nodes + child * fanout, nodes + (child + 1) * fanout, nodes[slot]);
+            nodes[slot] = child | child_bit;
+            node = child;
+        }
+
+        const std::size_t free_bits{(level + 1) * 8 - item.length};
+        auto* begin{nodes + node * fanout + item.key[level]};
+        std::fill(begin, begin + (std::size_t{1} << free_bits), item.entry);
+
+        const bool duplicate{i + 1 < count && items[i + 1].length == item.length && items[i + 1].is_4 == item.is_4 &&
+                             items[i + 1].key == item.key};
+        distinct += !duplicate;
+    }
+
+    table.size_ = distinct;
+    return table;
+}
+
+std::optional<std::uint32_t> sfap::net::PrefixTable::lookup(const ipx_t& address) const noexcept {
+    if (!nodes_)
+        return std::nullopt;
+
+    const auto* nodes{reinterpret_cast<const std::uint32_t*>(nodes_.data())};
+    const std::uint8_t* key{address.data()};
+    std::uint32_t node{address.is_4() ? ip4_root : ip6_root};
+
+    for (std::size_t level = 0; level < address.size(); ++level) {
+        const std::uint32_t entry{nodes[node * fanout + key[level]]};
+        if (!(entry & child_bit)) {
+            if (entry == 0)
+                return std::nullopt;
+            return entry - 1;
+        }
+        node = entry & ~child_bit;
+    }
+    return std::nullopt;
+}
+
+bool sfap::net::PrefixTable::contains(const ipx_t& address) const noexcept {
+    return lookup(address).has_value();
+}
+
+std::size_t sfap::net::PrefixTable::size() const noexcept {
+    return size_;
+}
+
+std::size_t sfap::net::PrefixTable::memory_usage() const noexcept {
+    return nodes_.capacity();
+}
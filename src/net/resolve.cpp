@@ -7,20 +7,32 @@
   \note License text intentionally omitted from docs. See repository LICENSE.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <optional>
+#include <new>
+#include <span>
+#include <string_view>
+
+#include <cstddef>
 
 #include <cstring>
 
 #if defined(_WIN32)
 #include <winsock2.h>
 #include <ws2tcpip.h>
+#include <windows.h>
 #else
 #include <netdb.h>
+#include <pthread.h>
 #include <sys/socket.h>
 #endif
 
 #include <sfap/error.hpp>
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/parse_ip.hpp>
 #include <sfap/net/resolve.hpp>
+#include <sfap/net/resolve_cache.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/string.hpp>
 
@@ -42,40 +54,83 @@ struct resolve_category final : public sfap::error_category {
     }
 };
 
-const auto resolve_error = [](int code) noexcept -> sfap::unexpected<sfap::error_code> {
+sfap::unexpected<sfap::error_code> sfap::net::resolve_error(int code) noexcept {
     static const resolve_category category;
     return sfap::unexpected<sfap::error_code>({code, category});
-};
+}
 
-sfap::result<sfap::net::ipx_t> sfap::net::resolve(const String& address, ResolveMode mode) noexcept {
-    return resolve(address.c_str(), mode);
+bool sfap::net::is_negative_answer(const sfap::error_code& error) noexcept {
+#if defined(EAI_NODATA) && EAI_NODATA != EAI_NONAME
+    if (error == resolve_error(EAI_NODATA).error())
+        return true;
+#endif
+#if defined(EAI_ADDRFAMILY)
+    if (error == resolve_error(EAI_ADDRFAMILY).error())
+        return true;
+#endif
+    return error == resolve_error(EAI_NONAME).error();
 }
 
-sfap::result<sfap::net::ipx_t> sfap::net::resolve(const char* address, ResolveMode mode) noexcept {
-    if (!address)
-        return resolve_error(EAI_NONAME);
+namespace {
 
+/// \return What getaddrinfo() reports for a numeric literal of a family its hints rule out.
+sfap::unexpected<sfap::error_code> family_mismatch() noexcept {
+#if defined(EAI_ADDRFAMILY)
+    return sfap::net::resolve_error(EAI_ADDRFAMILY);
+#else
+    return sfap::net::resolve_error(EAI_NONAME);
+#endif
+}
+
+addrinfo hints_for(sfap::net::ResolveMode mode) noexcept {
     addrinfo hints{};
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_flags = 0;
 
     switch (mode) {
-    case ResolveMode::REQUIRE_IPV4:
+    case sfap::net::ResolveMode::REQUIRE_IPV4:
         hints.ai_family = AF_INET;
         break;
-    case ResolveMode::REQUIRE_IPV6:
+    case sfap::net::ResolveMode::REQUIRE_IPV6:
         hints.ai_family = AF_INET6;
         break;
 
-    case ResolveMode::PREFER_IPV6:
-    case ResolveMode::PREFER_IPV4:
+    case sfap::net::ResolveMode::PREFER_IPV6:
+    case sfap::net::ResolveMode::PREFER_IPV4:
         hints.ai_family = AF_UNSPEC;
     }
+    return hints;
+}
+
+} // namespace
 
+sfap::result<sfap::net::ipx_t> sfap::net::resolve(const String& address, ResolveMode mode) noexcept {
+    return resolve(address.c_str(), mode);
+}
+
+sfap::result<sfap::net::ipx_t> sfap::net::resolve(const char* address, ResolveMode mode) noexcept {
+    if (address && parse_ip(std::string_view{address}))
+        return resolve_uncached(address, mode);
+    return ResolveCache::global().resolve(address, mode);
+}
+
+sfap::result<sfap::net::ipx_t> sfap::net::resolve_uncached(const char* address, ResolveMode mode) noexcept {
+    if (!address)
+        return resolve_error(EAI_NONAME);
+
+    // Numeric literals need no lookup. A family the mode rules out fails the
+    // same way getaddrinfo would with the family hint set.
+    if (auto ip = parse_ip(std::string_view{address})) {
+        if ((mode == ResolveMode::REQUIRE_IPV4 && !ip->is_4()) || (mode == ResolveMode::REQUIRE_IPV6 && !ip->is_6()))
+            return family_mismatch();
+        return *ip;
+    }
+
+    const addrinfo hints{hints_for(mode)};
     addrinfo* result = nullptr;
 
     if (const int result_code = ::getaddrinfo(address, nullptr, &hints, &result); result_code != 0)
-        return sfap::generic_error(sfap::errc::INVALID_ARGUMENT);
+        return resolve_error(result_code);
 
     std::optional<ip4_t> found_ipv4{};
     std::optional<ip6_t> found_ipv6{};
@@ -128,4 +183,177 @@ sfap::result<sfap::net::ipx_t> sfap::net::resolve(const char* address, ResolveMo
     }
 
     return resolve_error(EAI_NONAME);
-}
\ No newline at end of file
+}
+
+sfap::result<sfap::net::AddressList> sfap::net::resolve_all(const String& address, ResolveMode mode) noexcept {
+    return resolve_all(address.c_str(), mode);
+}
+
+sfap::result<sfap::net::AddressList> sfap::net::resolve_all(const char* address, ResolveMode mode) noexcept {
+    if (!address)
+        return resolve_error(EAI_NONAME);
+
+    AddressList list;
+    if (auto ip = parse_ip(std::string_view{address})) {
+        if ((mode == ResolveMode::REQUIRE_IPV4 && !ip->is_4()) || (mode == ResolveMode::REQUIRE_IPV6 && !ip->is_6()))
+            return family_mismatch();
+        if (!list.push_back(*ip))
+            return sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+        return list;
+    }
+
+    const addrinfo hints{hints_for(mode)};
+    addrinfo* result = nullptr;
+
+    if (const int result_code = ::getaddrinfo(address, nullptr, &hints, &result); result_code != 0)
+        return resolve_error(result_code);
+
+    // Two passes put the preferred family first without reordering within a family.
+    const int preferred{mode == ResolveMode::PREFER_IPV6 || mode == ResolveMode::REQUIRE_IPV6 ? AF_INET6 : AF_INET};
+    bool out_of_memory{false};
+
+    for (const int family : {preferred, preferred == AF_INET ? AF_INET6 : AF_INET}) {
+        for (addrinfo* info = result; info != nullptr && !out_of_memory; info = info->ai_next) {
+            if (info->ai_family != family)
+                continue;
+
+            ipx_t ip;
+            if (family == AF_INET) {
+                ip4_t ip4;
+                std::memcpy(ip4.data(), &reinterpret_cast<const sockaddr_in*>(info->ai_addr)->sin_addr, sizeof(ip4_t));
+                ip = ipx_t{ip4};
+            } else {
+                ip6_t ip6;
+                std::memcpy(ip6.data(), &reinterpret_cast<const sockaddr_in6*>(info->ai_addr)->sin6_addr,
+                            sizeof(ip6_t));
+                ip = ipx_t{ip6};
+            }
+
+            if (!list.contains(ip))
+                out_of_memory = !list.push_back(ip);
+        }
+    }
+
+    ::freeaddrinfo(result);
+
+    if (out_of_memory)
+        return sfap::generic_error(sfap::errc::NOT_ENOUGH_MEMORY);
+    if (list.empty())
+        return resolve_error(EAI_NONAME);
+    return list;
+}
+
+namespace {
+
+/// \brief Shared state of one resolve_batch() call.
+struct Batch {
+    std::span<const sfap::String> addresses;
+    std::span<sfap::result<sfap::net::ipx_t>> results;
+    sfap::net::ResolveMode mode;
+    std::size_t* order{};       ///< Input indices grouped by name.
+    std::size_t* groups{};      ///< Start of each group in `order`.
+    std::size_t group_count{};
+    std::atomic<std::size_t> next{0};
+
+    /// \brief Resolve groups until none is left.
+    void work() noexcept {
+        for (std::size_t g; (g = next.fetch_add(1, std::memory_order_relaxed)) < group_count;) {
+            const std::size_t i{order[groups[g]]};
+            results[i] = sfap::net::resolve(addresses[i], mode);
+        }
+    }
+};
+
+/// \brief Worker thread started without exceptions, unlike std::thread.
+class Helper {
+  public:
+    /// \return `false` if the thread could not be created.
+    bool start(Batch& batch) noexcept {
+#if defined(_WIN32)
+        thread_ = ::CreateThread(nullptr, 0, &Helper::entry, &batch, 0, nullptr);
+        return thread_ != nullptr;
+#else
+        return ::pthread_create(&thread_, nullptr, &Helper::entry, &batch) == 0;
+#endif
+    }
+
+    void join() noexcept {
+#if defined(_WIN32)
+        ::WaitForSingleObject(thread_, INFINITE);
+        ::CloseHandle(thread_);
+#else
+        ::pthread_join(thread_, nullptr);
+#endif
+    }
+
+  private:
+#if defined(_WIN32)
+    static DWORD WINAPI entry(LPVOID batch) noexcept {
+        static_cast<Batch*>(batch)->work();
+        return 0;
+    }
+
+    HANDLE thread_{};
+#else
+    static void* entry(void* batch) noexcept {
+        static_cast<Batch*>(batch)->work();
+        return nullptr;
+    }
+
+    pthread_t thread_{};
+#endif
+};
+
+} // namespace
+
+sfap::error_code sfap::net::resolve_batch(std::span<const String> addresses, std::span<sfap::result<ipx_t>> results,
+                                          ResolveMode mode, std::size_t parallelism) noexcept {
+    if (results.size() != addresses.size())
+        return generic_error(errc::INVALID_ARGUMENT).error();
+    if (addresses.empty())
+        return sfap::no_error();
+
+    Batch batch{addresses, results, mode};
+    batch.order = new (std::nothrow) std::size_t[2 * addresses.size()];
+    if (!batch.order) {
+        // No room to find duplicates: look every name up in turn.
+        for (std::size_t i = 0; i < addresses.size(); ++i)
+            results[i] = resolve(addresses[i], mode);
+        return sfap::no_error();
+    }
+    batch.groups = batch.order + addresses.size();
+
+    // Sort input indices by name, first occurrence first, and make each run
+    // of equal names one group resolved by its first index.
+    for (std::size_t i = 0; i < addresses.size(); ++i)
+        batch.order[i] = i;
+    std::sort(batch.order, batch.order + addresses.size(), [&](std::size_t a, std::size_t b) {
+        const std::string_view x{addresses[a].view()};
+        const std::string_view y{addresses[b].view()};
+        return x != y ? x < y : a < b;
+    });
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        if (i == 0 || addresses[batch.order[i]].view() != addresses[batch.order[i - 1]].view())
+            batch.groups[batch.group_count++] = i;
+    }
+
+    const std::size_t wanted{std::clamp<std::size_t>(parallelism, 1, batch.group_count)};
+    auto* helpers{wanted > 1 ? new (std::nothrow) Helper[wanted - 1] : nullptr};
+    std::size_t started{};
+    // Threads that fail to start are not replaced; the calling thread always works.
+    while (helpers && started + 1 < wanted && helpers[started].start(batch))
+        ++started;
+    batch.work();
+    for (std::size_t i = 0; i < started; ++i)
+        helpers[i].join();
+    delete[] helpers;
+
+    for (std::size_t g = 0; g < batch.group_count; ++g) {
+        const std::size_t end{g + 1 < batch.group_count ? batch.groups[g + 1] : addresses.size()};
+        const std::size_t first{batch.order[batch.groups[g]]};
+        for (std::size_t i = batch.groups[g] + 1; i < end; ++i)
+            results[batch.order[i]] = results[first];
+    }
+    delete[] batch.order;
+    return sfap::no_error();
+}
@@ -0,0 +1,249 @@
+/*!
+  \file
+  \brief Hostname resolution cache implementation.
+
+  \details
+  Per-shard intrusive LRU lists over a fixed entry array, indexed by an
+  open-addressed hash table; resolution always happens with the shard
+  unlocked.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string_view>
+
+#include <cstddef>
+#include <cstring>
+
+#include <sfap/error.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/resolve_cache.hpp>
+#include <sfap/net/types.hpp>
+
+sfap::net::ResolveCache::ResolveCache(const ResolveCacheOptions& options) noexcept
+    : options_(options), shard_capacity_(std::max<std::size_t>(1, (options.capacity + shard_count - 1) / shard_count)) {
+    if (!options_.resolver)
+        options_.resolver = &resolve_uncached;
+}
+
+sfap::net::ResolveCache::~ResolveCache() noexcept {
+    for (auto& shard : shards_) {
+        delete[] shard.index;
+        delete[] shard.entries;
+    }
+}
+
+sfap::net::ResolveCache& sfap::net::ResolveCache::global() noexcept {
+    static ResolveCache cache;
+    return cache;
+}
+
+sfap::result<sfap::net::ipx_t> sfap::net::ResolveCache::resolve(const char* hostname, ResolveMode mode) noexcept {
+    const std::size_t length{hostname ? std::strlen(hostname) : 0};
+    if (!hostname || length > max_hostname_size)
+        return options_.resolver(hostname, mode);
+
+    std::array<char, max_hostname_size + 1> buffer;
+    buffer[0] = static_cast<char>(mode);
+    std::memcpy(buffer.data() + 1, hostname, length);
+    const std::string_view key{buffer.data(), length + 1};
+    const std::size_t hash{std::hash<std::string_view>{}(key)};
+
+    Shard& shard{shards_[hash % shard_count]};
+    bool refresh{false};
+
+    {
+        std::lock_guard lock{shard.mutex};
+        if (Entry* entry = find(shard, key, hash)) {
+            const auto now{clock::now()};
+            if (now < entry->expires) {
+                touch(shard, entry);
+                ++entry->hits;
+
+                refresh = entry->value && !entry->refreshing && entry->hits >= options_.refresh_min_hits &&
+                          now >= entry->refresh_at;
+                if (!refresh) {
+                    (entry->value ? hits_ : negative_hits_).fetch_add(1, std::memory_order_relaxed);
+                    return entry->value;
+                }
+                entry->refreshing = true;
+            }
+        }
+    }
+
+    if (refresh) {
+        // Only this caller refreshes; everyone else keeps the cached answer meanwhile.
+        refreshes_.fetch_add(1, std::memory_order_relaxed);
+        const auto value{options_.resolver(hostname, mode)};
+
+        std::lock_guard lock{shard.mutex};
+        Entry* entry{find(shard, key, hash)};
+        if (!entry) {
+            // Evicted or cleared meanwhile.
+            if (value || is_negative_answer(value.error()))
+                store(shard, key, hash, value, clock::now());
+            return value;
+        }
+        entry->refreshing = false;
+        if (!value) {
+            // Back off instead of having every following hit wait on a resolver that just failed.
+            const auto ttl{std::chrono::duration_cast<clock::duration>(options_.positive_ttl)};
+            const auto refresh_window{std::chrono::duration_cast<clock::duration>(ttl * options_.refresh_ahead)};
+            entry->hits = 0;
+            entry->refresh_at = std::min(entry->expires, clock::now() + refresh_window / 2);
+            return entry->value;
+        }
+        store(shard, key, hash, value, clock::now());
+        return value;
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    const auto value{options_.resolver(hostname, mode)};
+
+    // A transient failure would otherwise be served to every caller for `negative_ttl`.
+    if (!value && !is_negative_answer(value.error()))
+        return value;
+
+    std::lock_guard lock{shard.mutex};
+    store(shard, key, hash, value, clock::now());
+    return value;
+}
+
+sfap::net::ResolveCache::Entry* sfap::net::ResolveCache::find(const Shard& shard, std::string_view key,
+                                                              std::size_t hash) noexcept {
+    if (!shard.index)
+        return nullptr;
+
+    for (std::size_t slot = (hash / shard_count) & shard.mask;; slot = (slot + 1) & shard.mask) {
+        Entry* entry{shard.index[slot]};
+        if (!entry || (entry->hash == hash && entry->view() == key))
+            return entry;
+    }
+}
+
+void sfap::net::ResolveCache::touch(Shard& shard, Entry* entry) noexcept {
+    if (shard.newest == entry)
+        return;
+
+    // Not the head, so `newer` is set.
+    entry->newer->older = entry->older;
+    if (entry->older)
+        entry->older->newer = entry->newer;
+    else
+        shard.oldest = entry->newer;
+
+    entry->newer = nullptr;
+    entry->older = shard.newest;
+    shard.newest->newer = entry;
+    shard.newest = entry;
+}
+
+void sfap::net::ResolveCache::unlink(Shard& shard, Entry* entry) noexcept {
+    (entry->newer ? entry->newer->older : shard.newest) = entry->older;
+    (entry->older ? entry->older->newer : shard.oldest) = entry->newer;
+
+    std::size_t slot{(entry->hash / shard_count) & shard.mask};
+    while (shard.index[slot] != entry)
+        slot = (slot + 1) & shard.mask;
+
+    // Backward-shift deletion: pull later entries of the probe run into the hole
+    // unless that would move them in front of their home slot.
+    for (std::size_t next = (slot + 1) & shard.mask; shard.index[next]; next = (next + 1) & shard.mask) {
+        const std::size_t home{(shard.index[next]->hash / shard_count) & shard.mask};
+        if (((next - home) & shard.mask) >= ((next - slot) & shard.mask)) {
+            shard.index[slot] = shard.index[next];
+            slot = next;
+        }
+    }
+    shard.index[slot] = nullptr;
+}
+
+bool sfap::net::ResolveCache::store(Shard& shard, std::string_view key, std::size_t hash,
+                                    const sfap::result<ipx_t>& value, clock::time_point now) noexcept {
+    if (!shard.entries) {
+        // At most half full, so probe runs stay short and always end at a free slot.
+        const std::size_t slots{std::bit_ceil(shard_capacity_ * 2)};
+        shard.entries = new (std::nothrow) Entry[shard_capacity_];
+        shard.index = shard.entries ? new (std::nothrow) Entry*[slots]{} : nullptr;
+        if (!shard.index) {
+            delete[] shard.entries;
+            shard.entries = nullptr;
+            return false;
+        }
+        shard.mask = slots - 1;
+    }
+
+    Entry* entry{find(shard, key, hash)};
+    if (entry) {
+        touch(shard, entry);
+    } else {
+        if (shard.size < shard_capacity_) {
+            entry = &shard.entries[shard.size++];
+        } else {
+            entry = shard.oldest;
+            unlink(shard, entry);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::memcpy(entry->key.data(), key.data(), key.size());
+        entry->key_size = key.size();
+        entry->hash = hash;
+
+        entry->newer = nullptr;
+        entry->older = shard.newest;
+        (shard.newest ? shard.newest->newer : shard.oldest) = entry;
+        shard.newest = entry;
+
+        std::size_t slot{(hash / shard_count) & shard.mask};
+        while (shard.index[slot])
+            slot = (slot + 1) & shard.mask;
+        shard.index[slot] = entry;
+    }
+
+    const auto ttl{std::chrono::duration_cast<clock::duration>(value ? options_.positive_ttl : options_.negative_ttl)};
+    const auto refresh_window{std::chrono::duration_cast<clock::duration>(ttl * options_.refresh_ahead)};
+
+    entry->value = value;
+    entry->expires = now + ttl;
+    entry->refresh_at = entry->expires - refresh_window;
+    entry->hits = 0;
+    entry->refreshing = false;
+    return true;
+}
+
+void sfap::net::ResolveCache::clear() noexcept {
+    for (auto& shard : shards_) {
+        std::lock_guard lock{shard.mutex};
+        if (shard.index)
+            std::fill_n(shard.index, shard.mask + 1, nullptr);
+        shard.size = 0;
+        shard.newest = nullptr;
+        shard.oldest = nullptr;
+    }
+}
+
+sfap::net::ResolveCache::Stats sfap::net::ResolveCache::stats() const noexcept {
+    std::size_t size{};
+    for (const auto& shard : shards_) {
+        std::lock_guard lock{shard.mutex};
+        size += shard.size;
+    }
+
+    return {
+        .hits = hits_.load(std::memory_order_relaxed),
+        .negative_hits = negative_hits_.load(std::memory_order_relaxed),
+        .misses = misses_.load(std::memory_order_relaxed),
+        .refreshes = refreshes_.load(std::memory_order_relaxed),
+        .evictions = evictions_.load(std::memory_order_relaxed),
+        .size = size,
+    };
+}
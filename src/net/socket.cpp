@@ -1,11 +1,16 @@
+#include <array>
 #include <span>
 #include <utility>
 
+#include <cerrno>
 #include <cstddef>
 
+#include <sfap/error.hpp>
 #include <sfap/net/proactor.hpp>
 #include <sfap/net/socket.hpp>
 #include <sfap/net/types.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
 
 sfap::net::Socket::Socket(sfap::net::Proactor* owner, socket_t handle) noexcept : owner_(owner), handle_(handle) {}
 
@@ -42,20 +47,47 @@ sfap::net::socket_t sfap::net::Socket::get_handle() const noexcept {
     return handle_;
 }
 
-sfap::task<void> sfap::net::Socket::send_bytes(std::span<const std::byte> data) noexcept {
-    if (!is_valid() || data.empty())
-        co_return;
+sfap::task<sfap::result<std::size_t>> sfap::net::Socket::send_bytes(std::span<const std::byte> data) noexcept {
+    if (!is_valid())
+        co_return generic_error(errc::INVALID_ARGUMENT);
 
     std::size_t offset = 0;
     while (offset < data.size()) {
         std::span<const std::byte> chunk = data.subspan(offset);
         const auto sent = co_await owner_->socket_send(handle_, chunk);
-        if (!sent || *sent == 0)
-            break;
+        if (!sent)
+            co_return sfap::unexpected<error_code>(sent.error());
+        if (*sent == 0)
+            co_return system_error(EPIPE);
         offset += *sent;
     }
 
-    co_return;
+    co_return offset;
+}
+
+sfap::task<sfap::result<std::size_t>> sfap::net::Socket::send_bytes(BufferSlice data) noexcept {
+    // `data` lives in this frame, so the bytes outlive every queued send.
+    co_return co_await send_bytes(data.view());
+}
+
+sfap::task<sfap::result<std::size_t>> sfap::net::Socket::send_bytes(BufferChain data) noexcept {
+    if (!is_valid())
+        co_return generic_error(errc::INVALID_ARGUMENT);
+
+    std::array<std::span<const std::byte>, max_send_segments> segments{};
+    std::size_t total = 0;
+    while (!data.empty()) {
+        const std::size_t count = data.gather(segments);
+        const auto sent = co_await owner_->socket_sendv(handle_, std::span{segments.data(), count});
+        if (!sent)
+            co_return sfap::unexpected<error_code>(sent.error());
+        if (*sent == 0)
+            co_return system_error(EPIPE);
+        data.consume(*sent);
+        total += *sent;
+    }
+
+    co_return total;
 }
 
 sfap::task<void> sfap::net::Socket::recv_bytes(std::span<std::byte> data, bool exact) noexcept {
@@ -0,0 +1,66 @@
+/*!
+  \file
+  \brief Per-connection TCP socket options implementation.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <cerrno>
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+#include <sfap/error.hpp>
+#include <sfap/net/socket_options.hpp>
+
+namespace {
+
+sfap::error_code set(int fd, int level, int name, int value) noexcept {
+    if (::setsockopt(fd, level, name, reinterpret_cast<const char*>(&value), sizeof(value)) != 0)
+        return sfap::network_error().error();
+    return sfap::no_error();
+}
+
+} // namespace
+
+sfap::error_code sfap::net::apply_socket_options(int fd, const SocketOptions& options) noexcept {
+    if (options.no_delay)
+        if (const auto error = set(fd, IPPROTO_TCP, TCP_NODELAY, 1))
+            return error;
+
+    if (options.send_buffer > 0)
+        if (const auto error = set(fd, SOL_SOCKET, SO_SNDBUF, options.send_buffer))
+            return error;
+
+    if (options.receive_buffer > 0)
+        if (const auto error = set(fd, SOL_SOCKET, SO_RCVBUF, options.receive_buffer))
+            return error;
+
+    if (options.not_sent_lowat > 0) {
+#if defined(TCP_NOTSENT_LOWAT)
+        if (const auto error = set(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, options.not_sent_lowat))
+            return error;
+#else
+        return network_error(ENOPROTOOPT).error();
+#endif
+    }
+
+    if (options.fast_open) {
+#if defined(TCP_FASTOPEN_CONNECT)
+        if (const auto error = set(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, 1))
+            return error;
+#else
+        return network_error(ENOPROTOOPT).error();
+#endif
+    }
+
+    return no_error();
+}
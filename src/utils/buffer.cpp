@@ -11,48 +11,291 @@
 */
 
 #include <algorithm>
+#include <limits>
 #include <new>
 #include <optional>
 #include <span>
 #include <utility>
 
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SFAP_BUFFER_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
 #include <sfap/utils/buffer.hpp>
+#include <sfap/utils/bufferpool.hpp>
+#include <sfap/utils/memory.hpp>
+
+namespace {
+
+/*
+  Search kernels over `[first, last)`. Each returns a pointer to the match or
+  `last`. Pattern kernels require `1 < m <= last - first`.
+
+  The pattern kernels filter candidates by comparing a whole register of
+  positions against the first and the last pattern byte at once; only
+  positions where both match are verified with `memcmp`. Tails shorter than a
+  register fall back to the scalar kernels.
+*/
+
+using FindByte = const std::byte* (*)(const std::byte*, const std::byte*, std::byte) noexcept;
+using FindPattern = const std::byte* (*)(const std::byte*, const std::byte*, const std::byte*, std::size_t) noexcept;
+
+const std::byte* find_byte_scalar(const std::byte* first, const std::byte* last, std::byte c) noexcept {
+    return std::find(first, last, c);
+}
+
+const std::byte* find_pattern_scalar(const std::byte* first, const std::byte* last, const std::byte* pattern,
+                                     std::size_t m) noexcept {
+    return std::search(first, last, pattern, pattern + m);
+}
+
+#if defined(SFAP_BUFFER_SIMD_X86)
+
+__attribute__((target("sse2"))) const std::byte* find_byte_sse2(const std::byte* first, const std::byte* last,
+                                                                std::byte c) noexcept {
+    const __m128i needle{_mm_set1_epi8(static_cast<char>(c))};
+    const std::byte* p{first};
+
+    for (; last - p >= 16; p += 16) {
+        const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+        const unsigned mask{static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)))};
+        if (mask)
+            return p + __builtin_ctz(mask);
+    }
+    return find_byte_scalar(p, last, c);
+}
+
+__attribute__((target("avx2"))) const std::byte* find_byte_avx2(const std::byte* first, const std::byte* last,
+                                                                std::byte c) noexcept {
+    const __m256i needle{_mm256_set1_epi8(static_cast<char>(c))};
+    const std::byte* p{first};
+
+    for (; last - p >= 32; p += 32) {
+        const __m256i block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+        const unsigned mask{static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)))};
+        if (mask)
+            return p + __builtin_ctz(mask);
+    }
+    return find_byte_sse2(p, last, c);
+}
+
+__attribute__((target("sse2"))) const std::byte* find_pattern_sse2(const std::byte* first, const std::byte* last,
+                                                                   const std::byte* pattern, std::size_t m) noexcept {
+    const __m128i head{_mm_set1_epi8(static_cast<char>(pattern[0]))};
+    const __m128i tail{_mm_set1_epi8(static_cast<char>(pattern[m - 1]))};
+    const std::byte* p{first};
+
+    for (; static_cast<std::size_t>(last - p) >= m - 1 + 16; p += 16) {
+        const __m128i a{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+        const __m128i b{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + m - 1))};
+        unsigned mask{static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, head), _mm_cmpeq_epi8(b, tail))))};
+
+        while (mask) {
+            const std::byte* candidate{p + __builtin_ctz(mask)};
+            if (std::memcmp(candidate + 1, pattern + 1, m - 2) == 0)
+                return candidate;
+            mask &= mask - 1;
+        }
+    }
+    return find_pattern_scalar(p, last, pattern, m);
+}
+
+__attribute__((target("avx2"))) const std::byte* find_pattern_avx2(const std::byte* first, const std::byte* last,
+                                                                   const std::byte* pattern, std::size_t m) noexcept {
+    const __m256i head{_mm256_set1_epi8(static_cast<char>(pattern[0]))};
+    const __m256i tail{_mm256_set1_epi8(static_cast<char>(pattern[m - 1]))};
+    const std::byte* p{first};
+
+    for (; static_cast<std::size_t>(last - p) >= m - 1 + 32; p += 32) {
+        const __m256i a{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+        const __m256i b{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + m - 1))};
+        unsigned mask{static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, head), _mm256_cmpeq_epi8(b, tail))))};
+
+        while (mask) {
+            const std::byte* candidate{p + __builtin_ctz(mask)};
+            if (std::memcmp(candidate + 1, pattern + 1, m - 2) == 0)
+                return candidate;
+            mask &= mask - 1;
+        }
+    }
+    return find_pattern_sse2(p, last, pattern, m);
+}
+
+bool has_avx2() noexcept {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+/// \return Widest byte kernel the CPU supports, resolved on first use.
+FindByte find_byte_kernel() noexcept {
+#if defined(SFAP_BUFFER_SIMD_X86)
+    static const FindByte kernel{has_avx2() ? find_byte_avx2 : find_byte_sse2};
+    return kernel;
+#else
+    return find_byte_scalar;
+#endif
+}
+
+/// \return Widest pattern kernel the CPU supports, resolved on first use.
+FindPattern find_pattern_kernel() noexcept {
+#if defined(SFAP_BUFFER_SIMD_X86)
+    static const FindPattern kernel{has_avx2() ? find_pattern_avx2 : find_pattern_sse2};
+    return kernel;
+#else
+    return find_pattern_scalar;
+#endif
+}
+
+} // namespace
 
 sfap::Buffer::Buffer(std::size_t capacity) noexcept
-    : data_(capacity ? new (std::nothrow) std::byte[capacity] : nullptr), capacity_(data_ ? capacity : 0), owner_(true),
-      size_(0) {}
+    : data_(capacity ? new (std::nothrow) std::byte[capacity] : nullptr), capacity_(data_ ? capacity : 0),
+      storage_(Storage::HEAP), size_(0) {}
+
+sfap::Buffer::Buffer(std::size_t capacity, const MemoryOptions& options) noexcept
+    : storage_(Storage::PAGES) {
+    if (capacity == 0)
+        return;
+
+    if (auto pages = allocate_pages(capacity, options); pages) {
+        data_ = pages->data();
+        capacity_ = pages->size();
+    }
+}
+
+sfap::Buffer::Buffer(std::size_t capacity, BufferPool& pool) noexcept {
+    if (capacity == 0)
+        return;
+
+    if (capacity > BufferPool::max_block_size) {
+        data_ = new (std::nothrow) std::byte[capacity];
+        capacity_ = data_ ? capacity : 0;
+        storage_ = Storage::HEAP;
+        return;
+    }
+
+    data_ = pool.acquire(capacity);
+    capacity_ = data_ ? BufferPool::block_size(capacity) : 0;
+    storage_ = Storage::POOLED;
+    pool_ = &pool;
+}
 
 sfap::Buffer::Buffer(std::span<std::byte> external) noexcept
     : data_(external.data() == nullptr || external.empty() ? nullptr : external.data()),
-      capacity_(data_ ? external.size() : 0), owner_(false), size_(0) {}
+      capacity_(data_ ? external.size() : 0), storage_(Storage::EXTERNAL), size_(0) {}
+
+sfap::Buffer::Buffer(growable_t, std::size_t capacity) noexcept : storage_(Storage::MALLOC), growable_(true) {
+    if (capacity && !reallocate(capacity))
+        growable_ = false;
+}
 
 sfap::Buffer::Buffer(Buffer&& o) noexcept
     : data_(std::exchange(o.data_, nullptr)), capacity_(std::exchange(o.capacity_, 0)),
-      owner_(std::exchange(o.owner_, false)), size_(std::exchange(o.size_, 0)) {}
+      storage_(std::exchange(o.storage_, Storage::EXTERNAL)), pool_(std::exchange(o.pool_, nullptr)),
+      growable_(std::exchange(o.growable_, false)), size_(std::exchange(o.size_, 0)) {}
 
 sfap::Buffer::~Buffer() noexcept {
-    if (owner_)
-        delete[] data_;
+    release();
 }
 
 sfap::Buffer& sfap::Buffer::operator=(Buffer&& o) noexcept {
     if (this != &o) {
-        if (owner_)
-            delete[] data_;
+        release();
 
         data_ = std::exchange(o.data_, nullptr);
         capacity_ = std::exchange(o.capacity_, 0);
-        owner_ = std::exchange(o.owner_, false);
+        storage_ = std::exchange(o.storage_, Storage::EXTERNAL);
+        pool_ = std::exchange(o.pool_, nullptr);
+        growable_ = std::exchange(o.growable_, false);
         size_ = std::exchange(o.size_, 0);
     }
     return *this;
 }
 
+void sfap::Buffer::release() noexcept {
+    switch (storage_) {
+    case Storage::HEAP:
+        delete[] data_;
+        break;
+    case Storage::PAGES:
+        if (data_)
+            release_pages({data_, capacity_});
+        break;
+    case Storage::POOLED:
+        if (data_)
+            pool_->release(data_, capacity_);
+        break;
+    case Storage::MALLOC:
+        std::free(data_);
+        break;
+    case Storage::EXTERNAL:
+        break;
+    }
+}
+
+bool sfap::Buffer::reallocate(std::size_t capacity) noexcept {
+    if (capacity == 0) {
+        release();
+        data_ = nullptr;
+        capacity_ = 0;
+        storage_ = Storage::MALLOC;
+        return true;
+    }
+
+    if (capacity >= page_growth_threshold) {
+        // Grow the mapping in place or let the kernel move its pages; no bytes are copied.
+        if (storage_ == Storage::PAGES) {
+            auto pages = resize_pages({data_, capacity_}, capacity);
+            if (!pages)
+                return false;
+            data_ = pages->data();
+            capacity_ = pages->size();
+            return true;
+        }
+
+        auto pages = allocate_pages(capacity);
+        if (!pages)
+            return false;
+        if (size_)
+            std::memcpy(pages->data(), data_, size_);
+        release();
+        data_ = pages->data();
+        capacity_ = pages->size();
+        storage_ = Storage::PAGES;
+        return true;
+    }
+
+    if (storage_ == Storage::PAGES) {
+        auto* p{static_cast<std::byte*>(std::malloc(capacity))};
+        if (!p)
+            return false;
+        std::memcpy(p, data_, std::min(size_, capacity));
+        release();
+        data_ = p;
+        capacity_ = capacity;
+        storage_ = Storage::MALLOC;
+        return true;
+    }
+
+    auto* p{static_cast<std::byte*>(std::realloc(data_, capacity))};
+    if (!p)
+        return false;
+    data_ = p;
+    capacity_ = capacity;
+    return true;
+}
+
 sfap::Buffer::operator bool() const noexcept {
-    return data_ != nullptr;
+    return data_ != nullptr || growable_;
 }
 
 std::size_t sfap::Buffer::capacity() const noexcept {
@@ -90,8 +333,32 @@ void sfap::Buffer::clean() noexcept {
     size_ = 0;
 }
 
+bool sfap::Buffer::is_growable() const noexcept {
+    return growable_;
+}
+
+bool sfap::Buffer::reserve(std::size_t n) noexcept {
+    if (n <= capacity_)
+        return true;
+    if (!growable_)
+        return false;
+
+    constexpr std::size_t min_capacity{64};
+    constexpr std::size_t max{std::numeric_limits<std::size_t>::max()};
+    const std::size_t doubled{capacity_ > max / 2 ? max : capacity_ * 2};
+    return reallocate(std::max({n, doubled, min_capacity}));
+}
+
+bool sfap::Buffer::shrink_to_fit() noexcept {
+    if (!growable_)
+        return false;
+    if (size_ == capacity_)
+        return true;
+    return reallocate(size_);
+}
+
 bool sfap::Buffer::resize(std::size_t n) noexcept {
-    if (n > capacity_)
+    if (!reserve(n))
         return false;
     size_ = n;
     return true;
@@ -152,7 +419,7 @@ std::optional<std::size_t> sfap::Buffer::find(std::byte c, std::size_t from) con
     if (from >= size_)
         return std::nullopt;
 
-    const auto position = std::find(begin() + from, end(), c);
+    const auto position = find_byte_kernel()(begin() + from, end(), c);
 
     if (position == end())
         return std::nullopt;
@@ -169,7 +436,9 @@ std::optional<std::size_t> sfap::Buffer::find(std::span<const std::byte> pattern
     if (from > size_ - pattern.size())
         return std::nullopt;
 
-    const auto position = std::search(begin() + from, end(), pattern.begin(), pattern.end());
+    const auto position = pattern.size() == 1
+                              ? find_byte_kernel()(begin() + from, end(), pattern[0])
+                              : find_pattern_kernel()(begin() + from, end(), pattern.data(), pattern.size());
 
     if (position == end())
         return std::nullopt;
@@ -177,24 +446,24 @@ std::optional<std::size_t> sfap::Buffer::find(std::span<const std::byte> pattern
 }
 
 bool sfap::Buffer::assign(std::span<const std::byte> source) noexcept {
-    if (!data_)
+    if (!data_ && !growable_)
         return false;
     if (source.empty()) {
         clean();
         return true;
     }
-    if (source.size() > capacity_)
+    if (!reserve(source.size()))
         return false;
     std::memcpy(data_, source.data(), source.size());
     return resize(source.size());
 }
 
 bool sfap::Buffer::append(std::span<const std::byte> source) noexcept {
-    if (!data_)
+    if (!data_ && !growable_)
         return false;
     if (source.empty())
         return true;
-    if (size_ + source.size() > capacity_)
+    if (!reserve(size_ + source.size()))
         return false;
 
     const std::size_t old_size = size_;
@@ -206,9 +475,9 @@ bool sfap::Buffer::append(std::span<const std::byte> source) noexcept {
 }
 
 bool sfap::Buffer::push_back(std::byte byte) noexcept {
-    if (!data_)
+    if (!data_ && !growable_)
         return false;
-    if (size_ >= capacity_)
+    if (!reserve(size_ + 1))
         return false;
 
     data_[size_++] = byte;
@@ -0,0 +1,226 @@
+/*!
+  \file
+  \brief Buffer chain implementation.
+
+  \details
+  Linked sequence of shared byte segments for assembling messages from
+  separately produced parts without copying.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <new>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+#include <cstring>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+
+sfap::BufferChain::BufferChain(BufferChain&& other) noexcept
+    : head_(std::exchange(other.head_, nullptr)), tail_(std::exchange(other.tail_, nullptr)),
+      segments_(std::exchange(other.segments_, 0)), size_(std::exchange(other.size_, 0)) {}
+
+sfap::BufferChain::~BufferChain() noexcept {
+    clear();
+}
+
+sfap::BufferChain& sfap::BufferChain::operator=(BufferChain&& other) noexcept {
+    if (this != &other) {
+        clear();
+        head_ = std::exchange(other.head_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+        segments_ = std::exchange(other.segments_, 0);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+std::size_t sfap::BufferChain::size() const noexcept {
+    return size_;
+}
+
+std::size_t sfap::BufferChain::segments() const noexcept {
+    return segments_;
+}
+
+bool sfap::BufferChain::empty() const noexcept {
+    return size_ == 0;
+}
+
+bool sfap::BufferChain::append(BufferSlice slice) noexcept {
+    if (slice.empty())
+        return true;
+
+    Node* node{new (std::nothrow) Node{std::move(slice)}};
+    if (!node)
+        return false;
+
+    link_back(node);
+    return true;
+}
+
+bool sfap::BufferChain::append(Buffer&& buffer) noexcept {
+    if (buffer.empty())
+        return true;
+
+    // Allocate the node first; SharedBuffer leaves `buffer` alone if its own allocation fails.
+    Node* node{new (std::nothrow) Node{}};
+    if (!node)
+        return false;
+
+    SharedBuffer shared{std::move(buffer)};
+    if (!shared) {
+        delete node;
+        return false;
+    }
+
+    node->slice = BufferSlice{std::move(shared)};
+    link_back(node);
+    return true;
+}
+
+void sfap::BufferChain::append(BufferChain&& other) noexcept {
+    if (this == &other || !other.head_)
+        return;
+
+    if (tail_)
+        tail_->next = other.head_;
+    else
+        head_ = other.head_;
+    tail_ = other.tail_;
+
+    segments_ += std::exchange(other.segments_, 0);
+    size_ += std::exchange(other.size_, 0);
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+}
+
+bool sfap::BufferChain::prepend(BufferSlice slice) noexcept {
+    if (slice.empty())
+        return true;
+
+    Node* node{new (std::nothrow) Node{std::move(slice)}};
+    if (!node)
+        return false;
+
+    link_front(node);
+    return true;
+}
+
+bool sfap::BufferChain::prepend(Buffer&& buffer) noexcept {
+    if (buffer.empty())
+        return true;
+
+    Node* node{new (std::nothrow) Node{}};
+    if (!node)
+        return false;
+
+    SharedBuffer shared{std::move(buffer)};
+    if (!shared) {
+        delete node;
+        return false;
+    }
+
+    node->slice = BufferSlice{std::move(shared)};
+    link_front(node);
+    return true;
+}
+
+void sfap::BufferChain::link_back(Node* node) noexcept {
+    if (tail_)
+        tail_->next = node;
+    else
+        head_ = node;
+    tail_ = node;
+
+    ++segments_;
+    size_ += node->slice.size();
+}
+
+void sfap::BufferChain::link_front(Node* node) noexcept {
+    node->next = head_;
+    head_ = node;
+    if (!tail_)
+        tail_ = node;
+
+    ++segments_;
+    size_ += node->slice.size();
+}
+
+std::span<const std::byte> sfap::BufferChain::front() const noexcept {
+    return head_ ? head_->slice.view() : std::span<const std::byte>{};
+}
+
+bool sfap::BufferChain::coalesce() noexcept {
+    if (segments_ <= 1)
+        return true;
+
+    Buffer joined{size_};
+    if (!joined || !joined.resize(size_))
+        return false;
+
+    std::size_t offset{};
+    for (const Node* node = head_; node; node = node->next) {
+        std::memcpy(joined.data() + offset, node->slice.data(), node->slice.size());
+        offset += node->slice.size();
+    }
+
+    SharedBuffer shared{std::move(joined)};
+    if (!shared)
+        return false;
+
+    Node* node{new (std::nothrow) Node{BufferSlice{std::move(shared)}}};
+    if (!node)
+        return false;
+
+    clear();
+    head_ = tail_ = node;
+    segments_ = 1;
+    size_ = offset;
+    return true;
+}
+
+std::size_t sfap::BufferChain::gather(std::span<std::span<const std::byte>> out) const noexcept {
+    std::size_t count{};
+    for (const Node* node = head_; node && count < out.size(); node = node->next)
+        out[count++] = node->slice.view();
+    return count;
+}
+
+void sfap::BufferChain::consume(std::size_t n) noexcept {
+    while (head_ && n) {
+        const std::size_t length{head_->slice.size()};
+        if (n < length) {
+            head_->slice = *head_->slice.subslice(n, length - n);
+            size_ -= n;
+            return;
+        }
+
+        Node* next{head_->next};
+        delete head_;
+        head_ = next;
+        --segments_;
+        size_ -= length;
+        n -= length;
+    }
+
+    if (!head_)
+        tail_ = nullptr;
+}
+
+void sfap::BufferChain::clear() noexcept {
+    while (head_) {
+        Node* next{head_->next};
+        delete head_;
+        head_ = next;
+    }
+    tail_ = nullptr;
+    segments_ = 0;
+    size_ = 0;
+}
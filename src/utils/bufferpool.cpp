@@ -0,0 +1,176 @@
+/*!
+  \file
+  \brief Buffer pool implementation.
+
+  \details
+  Size-class allocator for short-lived buffers with per-thread magazines in
+  front of a shared depot.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
+
+#include <cstddef>
+#include <cstring>
+
+#include <sfap/utils/bufferpool.hpp>
+
+sfap::BufferPool::BufferPool(std::size_t depot_limit) noexcept
+    : shards_(new (std::nothrow) Shard[shard_count]), depot_limit_(depot_limit) {}
+
+sfap::BufferPool::~BufferPool() noexcept {
+    trim();
+    delete[] shards_;
+}
+
+sfap::BufferPool::operator bool() const noexcept {
+    return shards_ != nullptr;
+}
+
+std::size_t sfap::BufferPool::class_index(std::size_t size) noexcept {
+    if (size <= min_block_size)
+        return 0;
+    return std::bit_width(size - 1) - std::bit_width(min_block_size - 1);
+}
+
+std::size_t sfap::BufferPool::shard_index() noexcept {
+    static std::atomic<std::size_t> next{};
+    thread_local const std::size_t index{next.fetch_add(1, std::memory_order_relaxed) % shard_count};
+    return index;
+}
+
+std::size_t sfap::BufferPool::block_size(std::size_t size) noexcept {
+    if (size == 0 || size > max_block_size)
+        return 0;
+    return min_block_size << class_index(size);
+}
+
+std::byte* sfap::BufferPool::acquire(std::size_t size) noexcept {
+    const std::size_t bytes{block_size(size)};
+    if (!shards_ || !bytes)
+        return nullptr;
+
+    const std::size_t index{class_index(size)};
+    std::byte* block{};
+    {
+        Shard& shard{shards_[shard_index()]};
+        std::lock_guard lock{shard.mutex};
+        Magazine& magazine{shard.magazines[index]};
+        if (magazine.count == 0)
+            refill(index, magazine);
+        if (magazine.count)
+            block = magazine.blocks[--magazine.count];
+    }
+
+    if (block) {
+        counters_[index].cached.fetch_sub(bytes, std::memory_order_relaxed);
+    } else {
+        block = new (std::nothrow) std::byte[bytes];
+        if (!block)
+            return nullptr;
+    }
+
+    track_live(index, bytes);
+    return block;
+}
+
+void sfap::BufferPool::release(std::byte* block, std::size_t size) noexcept {
+    const std::size_t bytes{block_size(size)};
+    if (!block || !shards_ || !bytes)
+        return;
+
+    const std::size_t index{class_index(size)};
+    counters_[index].live.fetch_sub(bytes, std::memory_order_relaxed);
+    counters_[index].cached.fetch_add(bytes, std::memory_order_relaxed);
+
+    Shard& shard{shards_[shard_index()]};
+    std::lock_guard lock{shard.mutex};
+    Magazine& magazine{shard.magazines[index]};
+    if (magazine.count == magazine_size)
+        spill(index, magazine);
+    magazine.blocks[magazine.count++] = block;
+}
+
+sfap::BufferPool::Stats sfap::BufferPool::stats(std::size_t index) const noexcept {
+    if (index >= class_count)
+        return {};
+
+    const Counters& c{counters_[index]};
+    return {min_block_size << index, c.live.load(std::memory_order_relaxed),
+            c.cached.load(std::memory_order_relaxed), c.peak.load(std::memory_order_relaxed)};
+}
+
+void sfap::BufferPool::trim() noexcept {
+    if (!shards_)
+        return;
+
+    for (std::size_t s = 0; s < shard_count; ++s) {
+        std::lock_guard lock{shards_[s].mutex};
+        for (std::size_t index = 0; index < class_count; ++index) {
+            Magazine& magazine{shards_[s].magazines[index]};
+            for (std::size_t i = 0; i < magazine.count; ++i)
+                delete[] magazine.blocks[i];
+            counters_[index].cached.fetch_sub(magazine.count * (min_block_size << index), std::memory_order_relaxed);
+            magazine.count = 0;
+        }
+    }
+
+    for (std::size_t index = 0; index < class_count; ++index) {
+        Depot& depot{depots_[index]};
+        std::lock_guard lock{depot.mutex};
+        while (depot.head) {
+            std::byte* block{depot.head};
+            std::memcpy(&depot.head, block, sizeof(depot.head));
+            delete[] block;
+        }
+        counters_[index].cached.fetch_sub(depot.count * (min_block_size << index), std::memory_order_relaxed);
+        depot.count = 0;
+    }
+}
+
+void sfap::BufferPool::refill(std::size_t index, Magazine& magazine) noexcept {
+    Depot& depot{depots_[index]};
+    std::lock_guard lock{depot.mutex};
+
+    std::size_t moved{};
+    for (; moved < magazine_size / 2 && depot.head; ++moved) {
+        std::byte* block{depot.head};
+        std::memcpy(&depot.head, block, sizeof(depot.head));
+        magazine.blocks[magazine.count++] = block;
+    }
+    depot.count -= moved;
+}
+
+void sfap::BufferPool::spill(std::size_t index, Magazine& magazine) noexcept {
+    Depot& depot{depots_[index]};
+    std::size_t freed{};
+    {
+        std::lock_guard lock{depot.mutex};
+        for (std::size_t i = 0; i < magazine_size / 2; ++i) {
+            std::byte* block{magazine.blocks[--magazine.count]};
+            if (depot.count < depot_limit_) {
+                std::memcpy(block, &depot.head, sizeof(depot.head));
+                depot.head = block;
+                ++depot.count;
+            } else {
+                delete[] block;
+                ++freed;
+            }
+        }
+    }
+    counters_[index].cached.fetch_sub(freed * (min_block_size << index), std::memory_order_relaxed);
+}
+
+void sfap::BufferPool::track_live(std::size_t index, std::size_t bytes) noexcept {
+    Counters& c{counters_[index]};
+    const std::size_t live{c.live.fetch_add(bytes, std::memory_order_relaxed) + bytes};
+    std::size_t peak{c.peak.load(std::memory_order_relaxed)};
+    while (live > peak && !c.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
@@ -0,0 +1,154 @@
+/*!
+  \file
+  \brief String intern pool implementation.
+
+  \details
+  Sharded open-addressing tables of views into per-shard, append-only arena
+  chunks.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+#include <cstring>
+
+#include <sfap/utils/intern.hpp>
+
+namespace {
+
+std::size_t shard_of(std::size_t hash) noexcept {
+    // The low bits select the slot inside the shard's table; use the high ones here.
+    return (hash >> (sizeof(std::size_t) * 8 - 4)) % sfap::InternPool::shard_count;
+}
+
+} // namespace
+
+sfap::InternPool::~InternPool() noexcept {
+    for (auto& shard : shards_) {
+        delete[] shard.slots;
+        for (Chunk* chunk = shard.chunks; chunk;) {
+            Chunk* next{chunk->next};
+            chunk->~Chunk();
+            delete[] reinterpret_cast<std::byte*>(chunk);
+            chunk = next;
+        }
+    }
+}
+
+sfap::InternPool& sfap::InternPool::global() noexcept {
+    static InternPool pool;
+    return pool;
+}
+
+std::string_view* sfap::InternPool::slot(std::string_view* slots, std::size_t capacity, std::string_view text,
+                                          std::size_t hash) noexcept {
+    const std::size_t mask{capacity - 1};
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        std::string_view& candidate{slots[i]};
+        if (!candidate.data() || candidate == text)
+            return &candidate;
+    }
+}
+
+bool sfap::InternPool::reserve(Shard& shard) noexcept {
+    // Keep the load at or below one half so probe sequences stay short.
+    if ((shard.count + 1) * 2 <= shard.capacity)
+        return true;
+
+    const std::size_t capacity{shard.capacity ? shard.capacity * 2 : 64};
+    auto* slots{new (std::nothrow) std::string_view[capacity]};
+    if (!slots)
+        return false;
+
+    for (std::size_t i = 0; i < shard.capacity; ++i) {
+        const std::string_view text{shard.slots[i]};
+        if (text.data())
+            *slot(slots, capacity, text, std::hash<std::string_view>{}(text)) = text;
+    }
+
+    delete[] shard.slots;
+    shard.slots = slots;
+    shard.capacity = capacity;
+    return true;
+}
+
+char* sfap::InternPool::allocate(Shard& shard, std::size_t n) noexcept {
+    Chunk* head{shard.chunks};
+    if (head && head->capacity - head->used >= n) {
+        char* p{reinterpret_cast<char*>(head + 1) + head->used};
+        head->used += n;
+        return p;
+    }
+
+    const std::size_t capacity{n > chunk_size / 4 ? n : chunk_size - sizeof(Chunk)};
+    auto* raw{new (std::nothrow) std::byte[sizeof(Chunk) + capacity]};
+    if (!raw)
+        return nullptr;
+
+    auto* chunk{new (raw) Chunk{nullptr, n, capacity}};
+    if (n > chunk_size / 4 && head) {
+        // Dedicated chunk: keep the partially used head for the next small string.
+        chunk->next = head->next;
+        head->next = chunk;
+    } else {
+        chunk->next = head;
+        shard.chunks = chunk;
+    }
+    return reinterpret_cast<char*>(chunk + 1);
+}
+
+std::optional<std::string_view> sfap::InternPool::intern(std::string_view text) noexcept {
+    const std::size_t hash{std::hash<std::string_view>{}(text)};
+    Shard& shard{shards_[shard_of(hash)]};
+
+    std::lock_guard lock{shard.mutex};
+    if (shard.capacity) {
+        if (const std::string_view found{*slot(shard.slots, shard.capacity, text, hash)}; found.data())
+            return found;
+    }
+
+    // Grow the table before taking arena bytes, so a failure leaves nothing behind.
+    if (!reserve(shard))
+        return std::nullopt;
+    char* storage{allocate(shard, text.size() + 1)};
+    if (!storage)
+        return std::nullopt;
+    if (!text.empty())
+        std::memcpy(storage, text.data(), text.size());
+    storage[text.size()] = '\0';
+
+    const std::string_view pooled{storage, text.size()};
+    *slot(shard.slots, shard.capacity, pooled, hash) = pooled;
+    ++shard.count;
+    size_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(text.size() + 1, std::memory_order_relaxed);
+    return pooled;
+}
+
+std::optional<std::string_view> sfap::InternPool::find(std::string_view text) const noexcept {
+    const std::size_t hash{std::hash<std::string_view>{}(text)};
+    const Shard& shard{shards_[shard_of(hash)]};
+
+    std::lock_guard lock{shard.mutex};
+    if (!shard.capacity)
+        return std::nullopt;
+    if (const std::string_view found{*slot(shard.slots, shard.capacity, text, hash)}; found.data())
+        return found;
+    return std::nullopt;
+}
+
+std::size_t sfap::InternPool::size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+}
+
+std::size_t sfap::InternPool::bytes() const noexcept {
+    return bytes_.load(std::memory_order_relaxed);
+}
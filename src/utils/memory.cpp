@@ -0,0 +1,223 @@
+/*!
+  \file
+  \brief Page-backed memory implementation.
+
+  \details
+  Anonymous page mappings with huge page, NUMA placement and pre-faulting
+  options for large long-lived buffers.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <new>
+#include <span>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <sfap/error.hpp>
+#include <sfap/utils/memory.hpp>
+
+namespace {
+
+constexpr std::size_t default_huge_page_size{std::size_t{2} << 20};
+
+#if defined(__linux__)
+
+/// \return \p n rounded up to a multiple of \p page, or `0` on overflow.
+std::size_t round_up(std::size_t n, std::size_t page) noexcept {
+    if (n > std::numeric_limits<std::size_t>::max() - (page - 1))
+        return 0;
+    return (n + page - 1) & ~(page - 1);
+}
+
+std::size_t read_huge_page_size() noexcept {
+    std::FILE* meminfo{std::fopen("/proc/meminfo", "r")};
+    if (!meminfo)
+        return default_huge_page_size;
+
+    std::size_t kib{};
+    char line[128];
+    while (std::fgets(line, sizeof(line), meminfo)) {
+        if (std::sscanf(line, "Hugepagesize: %zu kB", &kib) == 1)
+            break;
+    }
+    std::fclose(meminfo);
+
+    const std::size_t bytes{kib * 1024};
+    return bytes && std::has_single_bit(bytes) ? bytes : default_huge_page_size;
+}
+
+std::size_t base_page_size() noexcept {
+    static const std::size_t size{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+    return size;
+}
+
+void* map_anonymous(std::size_t size, int flags) noexcept {
+    void* p{::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0)};
+    return p == MAP_FAILED ? nullptr : p;
+}
+
+/*!
+  \brief Map \p size bytes starting at a multiple of \p alignment.
+  \details Transparent huge pages only back aligned ranges, so the mapping is
+           over-allocated by one alignment unit and both ends are trimmed.
+*/
+void* map_aligned(std::size_t size, std::size_t alignment) noexcept {
+    const std::size_t length{size + alignment};
+    if (length < size) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+
+    void* raw{map_anonymous(length, 0)};
+    if (!raw)
+        return nullptr;
+
+    const auto base{reinterpret_cast<std::uintptr_t>(raw)};
+    const auto begin{(base + alignment - 1) & ~(alignment - 1)};
+    const auto end{begin + size};
+
+    if (begin > base)
+        ::munmap(raw, begin - base);
+    if (base + length > end)
+        ::munmap(reinterpret_cast<void*>(end), base + length - end);
+
+    return reinterpret_cast<void*>(begin);
+}
+
+bool bind_node(void* p, std::size_t size, int node) noexcept {
+    constexpr std::size_t max_nodes{1024};
+    constexpr std::size_t word_bits{std::numeric_limits<unsigned long>::digits};
+
+    if (node < 0 || static_cast<std::size_t>(node) >= max_nodes) {
+        errno = EINVAL;
+        return false;
+    }
+
+    std::array<unsigned long, max_nodes / word_bits> mask{};
+    mask[node / word_bits] |= 1UL << (node % word_bits);
+
+    // The kernel treats `maxnode` as one past the last valid bit.
+    return ::syscall(SYS_mbind, p, size, MPOL_BIND, mask.data(), max_nodes + 1, MPOL_MF_MOVE) == 0;
+}
+
+void prefault(void* p, std::size_t size) noexcept {
+#if defined(MADV_POPULATE_WRITE)
+    if (::madvise(p, size, MADV_POPULATE_WRITE) == 0)
+        return;
+#endif
+    // Older kernels: write one byte per page. Anonymous pages are zero-filled,
+    // so writing zero keeps the contents while forcing the fault now.
+    auto* bytes{static_cast<volatile std::byte*>(p)};
+    for (std::size_t offset = 0; offset < size; offset += base_page_size())
+        bytes[offset] = std::byte{0};
+}
+
+#endif
+
+} // namespace
+
+std::size_t sfap::huge_page_size() noexcept {
+#if defined(__linux__)
+    static const std::size_t size{read_huge_page_size()};
+    return size;
+#else
+    return default_huge_page_size;
+#endif
+}
+
+sfap::result<std::span<std::byte>> sfap::allocate_pages(std::size_t size, const MemoryOptions& options) noexcept {
+    if (size == 0)
+        return generic_error(errc::INVALID_ARGUMENT);
+
+#if defined(__linux__)
+    using Pages = MemoryOptions::Pages;
+
+    const std::size_t page{options.pages == Pages::DEFAULT ? base_page_size() : huge_page_size()};
+    const std::size_t length{round_up(size, page)};
+    if (length == 0)
+        return generic_error(errc::NOT_ENOUGH_MEMORY);
+
+    void* p{};
+    if (options.pages == Pages::HUGE)
+        p = map_anonymous(length, MAP_HUGETLB);
+
+    if (!p) {
+        p = options.pages == Pages::DEFAULT ? map_anonymous(length, 0) : map_aligned(length, page);
+        if (!p)
+            return system_error();
+        if (options.pages != Pages::DEFAULT)
+            ::madvise(p, length, MADV_HUGEPAGE);
+    }
+
+    if (options.numa_node >= 0 && !bind_node(p, length, options.numa_node)) {
+        const int error{errno};
+        ::munmap(p, length);
+        return system_error(error);
+    }
+
+    if (options.prefault)
+        prefault(p, length);
+
+    return std::span<std::byte>{static_cast<std::byte*>(p), length};
+#else
+    (void)options;
+    auto* p{new (std::nothrow) std::byte[size]};
+    if (!p)
+        return generic_error(errc::NOT_ENOUGH_MEMORY);
+    return std::span<std::byte>{p, size};
+#endif
+}
+
+sfap::result<std::span<std::byte>> sfap::resize_pages(std::span<std::byte> pages, std::size_t size) noexcept {
+    if (pages.empty())
+        return allocate_pages(size);
+    if (size == 0)
+        return generic_error(errc::INVALID_ARGUMENT);
+
+#if defined(__linux__)
+    const std::size_t length{round_up(size, base_page_size())};
+    if (length == 0)
+        return generic_error(errc::NOT_ENOUGH_MEMORY);
+
+    void* p{::mremap(pages.data(), pages.size(), length, MREMAP_MAYMOVE)};
+    if (p == MAP_FAILED)
+        return system_error();
+    return std::span<std::byte>{static_cast<std::byte*>(p), length};
+#else
+    auto fresh{allocate_pages(size)};
+    if (!fresh)
+        return fresh;
+    std::memcpy(fresh->data(), pages.data(), std::min(pages.size(), fresh->size()));
+    release_pages(pages);
+    return fresh;
+#endif
+}
+
+void sfap::release_pages(std::span<std::byte> pages) noexcept {
+    if (pages.empty())
+        return;
+
+#if defined(__linux__)
+    ::munmap(pages.data(), pages.size());
+#else
+    delete[] pages.data();
+#endif
+}
@@ -0,0 +1,204 @@
+/*!
+  \file
+  \brief Multi-producer record ring buffer implementation.
+
+  \details
+  Bounded lock-free queues of variable-length byte records for fan-in
+  (MPSC) and work distribution (MPMC), using the same zero-copy
+  {prepare,commit}_{write,read} pattern as `RingBuffer`.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <new>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sfap/utils/mpringbuffer.hpp>
+
+namespace {
+
+enum State : std::uint64_t { EMPTY = 0, COMMITTED = 1, PADDING = 2, CONSUMED = 3 };
+
+constexpr std::uint64_t make_tag(std::uint64_t position, State state) noexcept {
+    return (position << 2) | state;
+}
+
+} // namespace
+
+template <bool MultiConsumer> sfap::MpRingBuffer<MultiConsumer>::MpRingBuffer(std::size_t n) noexcept {
+    if (n < block_size || !std::has_single_bit(n))
+        return;
+
+    data_ = new (std::nothrow) std::byte[n];
+    slots_ = data_ ? new (std::nothrow) Slot[n / block_size] : nullptr;
+    if (!slots_) {
+        delete[] data_;
+        data_ = nullptr;
+        return;
+    }
+
+    capacity_ = n;
+    blocks_ = n / block_size;
+    mask_ = blocks_ - 1;
+}
+
+template <bool MultiConsumer> sfap::MpRingBuffer<MultiConsumer>::~MpRingBuffer() noexcept {
+    delete[] slots_;
+    delete[] data_;
+}
+
+template <bool MultiConsumer> sfap::MpRingBuffer<MultiConsumer>::operator bool() const noexcept {
+    return data_ != nullptr;
+}
+
+template <bool MultiConsumer> std::size_t sfap::MpRingBuffer<MultiConsumer>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <bool MultiConsumer> std::size_t sfap::MpRingBuffer<MultiConsumer>::size() const noexcept {
+    const std::uint64_t t{tail_.load(std::memory_order_acquire)};
+    const std::uint64_t h{head_.load(std::memory_order_acquire)};
+    return h > t ? std::min(static_cast<std::size_t>(h - t) * block_size, capacity_) : 0;
+}
+
+template <bool MultiConsumer> bool sfap::MpRingBuffer<MultiConsumer>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <bool MultiConsumer>
+typename sfap::MpRingBuffer<MultiConsumer>::WriteRecord
+sfap::MpRingBuffer<MultiConsumer>::prepare_write(std::size_t n) noexcept {
+    if (!data_ || n == 0 || n > capacity_)
+        return {};
+
+    const std::uint64_t k{(n + block_size - 1) / block_size};
+    std::uint64_t h{head_.load(std::memory_order_relaxed)};
+    std::uint64_t pad{};
+
+    for (;;) {
+        const std::uint64_t offset{h & mask_};
+        pad = offset + k > blocks_ ? blocks_ - offset : 0;
+
+        // Padding holds no bytes. On an empty ring nothing is live for the
+        // record to overlap, so only its own blocks count; otherwise records
+        // that fit the ring could be refused depending on where head sits.
+        const std::uint64_t t{tail_.load(std::memory_order_acquire)};
+        const std::uint64_t needed{h == t ? k : pad + k};
+        if (h < t || h - t + needed > blocks_) {
+            const std::uint64_t fresh{head_.load(std::memory_order_relaxed)};
+            if (fresh == h)
+                return {};
+            h = fresh;
+            continue;
+        }
+
+        if (head_.compare_exchange_weak(h, h + pad + k, std::memory_order_relaxed))
+            break;
+    }
+
+    if (pad) {
+        Slot& slot{slots_[h & mask_]};
+        slot.length.store(pad * block_size, std::memory_order_relaxed);
+        slot.tag.store(make_tag(h, PADDING), std::memory_order_release);
+    }
+
+    const std::uint64_t position{h + pad};
+    slots_[position & mask_].length.store(n, std::memory_order_relaxed);
+
+    return {std::span<std::byte>(data_ + (position & mask_) * block_size, n), position};
+}
+
+template <bool MultiConsumer>
+bool sfap::MpRingBuffer<MultiConsumer>::commit_write(const WriteRecord& record) noexcept {
+    if (!record)
+        return false;
+
+    slots_[record.position & mask_].tag.store(make_tag(record.position, COMMITTED), std::memory_order_release);
+    return true;
+}
+
+template <bool MultiConsumer>
+typename sfap::MpRingBuffer<MultiConsumer>::ReadRecord sfap::MpRingBuffer<MultiConsumer>::prepare_read() noexcept {
+    if (!data_)
+        return {};
+
+    std::uint64_t r{read_.load(std::memory_order_acquire)};
+
+    for (;;) {
+        Slot& slot{slots_[r & mask_]};
+        const std::uint64_t tag{slot.tag.load(std::memory_order_acquire)};
+
+        if (tag != make_tag(r, COMMITTED) && tag != make_tag(r, PADDING)) {
+            if constexpr (!MultiConsumer)
+                return {};
+
+            const std::uint64_t fresh{read_.load(std::memory_order_acquire)};
+            if (fresh == r)
+                return {};
+            r = fresh;
+            continue;
+        }
+
+        const std::size_t length{slot.length.load(std::memory_order_relaxed)};
+        const std::uint64_t next{r + (length + block_size - 1) / block_size};
+
+        if constexpr (MultiConsumer) {
+            if (!read_.compare_exchange_weak(r, next, std::memory_order_acq_rel))
+                continue;
+        } else {
+            read_.store(next, std::memory_order_relaxed);
+        }
+
+        if (tag == make_tag(r, PADDING)) {
+            release(r);
+            r = next;
+            continue;
+        }
+
+        return {std::span<const std::byte>(data_ + (r & mask_) * block_size, length), r};
+    }
+}
+
+template <bool MultiConsumer>
+bool sfap::MpRingBuffer<MultiConsumer>::commit_read(const ReadRecord& record) noexcept {
+    if (!record)
+        return false;
+
+    release(record.position);
+    return true;
+}
+
+template <bool MultiConsumer> void sfap::MpRingBuffer<MultiConsumer>::release(std::uint64_t position) noexcept {
+    // With several consumers, a consumer releasing a record out of order and
+    // the one advancing `tail_` must not both miss each other: sequentially
+    // consistent tag store / tail load on one side and tail update / tag load
+    // on the other guarantee at least one of them observes the other.
+    constexpr auto order{MultiConsumer ? std::memory_order_seq_cst : std::memory_order_release};
+    constexpr auto load_order{MultiConsumer ? std::memory_order_seq_cst : std::memory_order_acquire};
+
+    slots_[position & mask_].tag.store(make_tag(position, CONSUMED), order);
+
+    std::uint64_t t{tail_.load(load_order)};
+    for (;;) {
+        Slot& slot{slots_[t & mask_]};
+        if (slot.tag.load(load_order) != make_tag(t, CONSUMED))
+            return;
+
+        const std::size_t length{slot.length.load(std::memory_order_relaxed)};
+        const std::uint64_t next{t + (length + block_size - 1) / block_size};
+
+        if (tail_.compare_exchange_strong(t, next, order, load_order))
+            t = next;
+    }
+}
+
+template class sfap::MpRingBuffer<false>;
+template class sfap::MpRingBuffer<true>;
@@ -14,52 +14,88 @@
 #include <algorithm>
 #include <atomic>
 #include <bit>
+#include <coroutine>
 #include <new>
 #include <span>
 #include <utility>
 
 #include <cstddef>
 
+#if defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <sfap/utils/memory.hpp>
 #include <sfap/utils/ringbuffer.hpp>
 
 sfap::RingBuffer::RingBuffer(std::size_t n) noexcept
     : data_((n && std::has_single_bit(n)) ? new (std::nothrow) std::byte[n] : nullptr), capacity_(data_ ? n : 0),
-      is_owner_(data_ != nullptr), mask_(capacity_ ? capacity_ - 1 : 0), head_(0), tail_(0), pending_w_(0),
-      pending_r_(0) {}
+      storage_(Storage::HEAP), mask_(capacity_ ? capacity_ - 1 : 0), head_(0), tail_cache_(0), pending_w_(0),
+      tail_(0), head_cache_(0), pending_r_(0) {}
+
+sfap::RingBuffer::RingBuffer(std::size_t n, const MemoryOptions& options) noexcept : storage_(Storage::PAGES) {
+    if (!n || !std::has_single_bit(n))
+        return;
+
+    // Page sizes are powers of two, so the rounded mapping still is one.
+    if (auto pages = allocate_pages(n, options); pages) {
+        data_ = pages->data();
+        capacity_ = pages->size();
+        mask_ = capacity_ - 1;
+    }
+}
 
 sfap::RingBuffer::RingBuffer(std::span<std::byte> external) noexcept
     : data_(external.empty() || !std::has_single_bit(external.size()) ? nullptr : external.data()),
-      capacity_(data_ ? external.size() : 0), is_owner_(false), mask_(capacity_ ? capacity_ - 1 : 0), head_(0),
-      tail_(0), pending_w_(0), pending_r_(0) {}
+      capacity_(data_ ? external.size() : 0), storage_(Storage::EXTERNAL), mask_(capacity_ ? capacity_ - 1 : 0),
+      head_(0), tail_cache_(0), pending_w_(0), tail_(0), head_cache_(0), pending_r_(0) {}
 
 sfap::RingBuffer::RingBuffer(RingBuffer&& other) noexcept
     : data_(std::exchange(other.data_, nullptr)), capacity_(std::exchange(other.capacity_, 0)),
-      is_owner_(std::exchange(other.is_owner_, false)), mask_(std::exchange(other.mask_, 0)),
-      head_(other.head_.exchange(0, std::memory_order_relaxed)),
-      tail_(other.tail_.exchange(0, std::memory_order_relaxed)), pending_w_(std::exchange(other.pending_w_, 0)),
-      pending_r_(std::exchange(other.pending_r_, 0)) {}
+      storage_(std::exchange(other.storage_, Storage::EXTERNAL)), mask_(std::exchange(other.mask_, 0)),
+      awaited_(other.awaited_.load(std::memory_order_relaxed)),
+      head_(other.head_.exchange(0, std::memory_order_relaxed)), tail_cache_(std::exchange(other.tail_cache_, 0)),
+      pending_w_(std::exchange(other.pending_w_, 0)), tail_(other.tail_.exchange(0, std::memory_order_relaxed)),
+      head_cache_(std::exchange(other.head_cache_, 0)), pending_r_(std::exchange(other.pending_r_, 0)) {}
 
 sfap::RingBuffer::~RingBuffer() noexcept {
-    if (is_owner_)
-        delete[] data_;
+    release();
 }
 
 sfap::RingBuffer& sfap::RingBuffer::operator=(RingBuffer&& other) noexcept {
     if (this != &other) {
-        if (is_owner_)
-            delete[] data_;
+        release();
         data_ = std::exchange(other.data_, nullptr);
         capacity_ = std::exchange(other.capacity_, 0);
-        is_owner_ = std::exchange(other.is_owner_, false);
+        storage_ = std::exchange(other.storage_, Storage::EXTERNAL);
         mask_ = std::exchange(other.mask_, 0);
+        awaited_.store(other.awaited_.load(std::memory_order_relaxed), std::memory_order_relaxed);
         head_.store(other.head_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
-        tail_.store(other.tail_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        tail_cache_ = std::exchange(other.tail_cache_, 0);
         pending_w_ = std::exchange(other.pending_w_, 0);
+        tail_.store(other.tail_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        head_cache_ = std::exchange(other.head_cache_, 0);
         pending_r_ = std::exchange(other.pending_r_, 0);
     }
     return *this;
 }
 
+void sfap::RingBuffer::release() noexcept {
+    switch (storage_) {
+    case Storage::HEAP:
+        delete[] data_;
+        break;
+    case Storage::PAGES:
+        if (data_)
+            release_pages({data_, capacity_});
+        break;
+    case Storage::EXTERNAL:
+        break;
+    }
+}
+
 sfap::RingBuffer::operator bool() const noexcept {
     return data_ != nullptr;
 }
@@ -87,6 +123,7 @@ bool sfap::RingBuffer::full() const noexcept {
 void sfap::RingBuffer::clean() noexcept {
     head_.store(0, std::memory_order_relaxed);
     tail_.store(0, std::memory_order_relaxed);
+    tail_cache_ = head_cache_ = 0;
     pending_w_ = pending_r_ = 0;
 }
 
@@ -98,11 +135,13 @@ sfap::RingBuffer::InputView sfap::RingBuffer::prepare_write(std::size_t n) noexc
     if (!data_ || n == 0)
         return {};
 
-    const std::size_t t{tail_.load(std::memory_order_acquire)};
     const std::size_t h{head_.load(std::memory_order_relaxed)};
 
-    const std::size_t used{h - t};
-    const std::size_t free{capacity_ - used};
+    std::size_t free{capacity_ - (h - tail_cache_)};
+    if (free <= pending_w_ || free - pending_w_ < n) {
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        free = capacity_ - (h - tail_cache_);
+    }
     const std::size_t available{free > pending_w_ ? free - pending_w_ : 0};
 
     const std::size_t take{std::min(n, available)};
@@ -131,6 +170,7 @@ std::size_t sfap::RingBuffer::commit_write(std::size_t n) noexcept {
 
     head_.store(new_h, std::memory_order_release);
     pending_w_ -= can;
+    wake(read_waiter_);
 
     return can;
 }
@@ -139,13 +179,16 @@ bool sfap::RingBuffer::put(std::byte c) noexcept {
     if (!data_)
         return false;
 
-    const std::size_t t{tail_.load(std::memory_order_acquire)};
     const std::size_t h{head_.load(std::memory_order_relaxed)};
-    if ((capacity_ - (h - t)) == 0)
-        return false;
+    if (h - tail_cache_ == capacity_) {
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        if (h - tail_cache_ == capacity_)
+            return false;
+    }
 
     data_[h & mask_] = c;
     head_.store(h + 1, std::memory_order_release);
+    wake(read_waiter_);
 
     return true;
 }
@@ -154,10 +197,13 @@ sfap::RingBuffer::OutputView sfap::RingBuffer::prepare_read(std::size_t n) noexc
     if (!data_ || n == 0)
         return {};
 
-    const std::size_t h{head_.load(std::memory_order_acquire)};
     const std::size_t t{tail_.load(std::memory_order_relaxed)};
 
-    const std::size_t s{h - t};
+    std::size_t s{head_cache_ - t};
+    if (s <= pending_r_ || s - pending_r_ < n) {
+        head_cache_ = head_.load(std::memory_order_acquire);
+        s = head_cache_ - t;
+    }
     const std::size_t avail{s > pending_r_ ? s - pending_r_ : 0};
 
     const std::size_t take{std::min(n, avail)};
@@ -185,6 +231,7 @@ std::size_t sfap::RingBuffer::commit_read(std::size_t n) noexcept {
 
     tail_.store(new_t, std::memory_order_release);
     pending_r_ -= can;
+    wake(write_waiter_);
 
     return can;
 }
@@ -193,13 +240,110 @@ bool sfap::RingBuffer::pop(std::byte& c) noexcept {
     if (!data_)
         return false;
 
-    const std::size_t h{head_.load(std::memory_order_acquire)};
     const std::size_t t{tail_.load(std::memory_order_relaxed)};
-    if ((h - t) == 0)
-        return false;
+    if (head_cache_ == t) {
+        head_cache_ = head_.load(std::memory_order_acquire);
+        if (head_cache_ == t)
+            return false;
+    }
 
     c = data_[t & mask_];
     tail_.store(t + 1, std::memory_order_release);
+    wake(write_waiter_);
 
     return true;
-}
\ No newline at end of file
+}
+
+sfap::RingBuffer::Awaiter sfap::RingBuffer::readable(std::size_t n, Executor* executor) noexcept {
+    return Awaiter{*this, true, n, executor};
+}
+
+sfap::RingBuffer::Awaiter sfap::RingBuffer::writable(std::size_t n, Executor* executor) noexcept {
+    return Awaiter{*this, false, n, executor};
+}
+
+bool sfap::RingBuffer::asymmetric_fence() noexcept {
+#if defined(__linux__) && defined(MEMBARRIER_CMD_PRIVATE_EXPEDITED)
+    static const bool registered{::syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0};
+    return registered;
+#else
+    return false;
+#endif
+}
+
+void sfap::RingBuffer::wake(std::atomic<Awaiter*>& slot) noexcept {
+    // Never awaited: the first waiter's membarrier() stands in for our half
+    // of the fence, so only keep the compiler from moving the index store
+    // past this load.
+    if (!awaited_.load(std::memory_order_relaxed)) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        return;
+    }
+
+    // Pairs with the fence in `Awaiter::await_suspend()`: either the waiter
+    // sees the index just published, or this load sees the waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    Awaiter* waiter{slot.load(std::memory_order_relaxed)};
+    if (!waiter || !slot.compare_exchange_strong(waiter, nullptr, std::memory_order_acq_rel))
+        return;
+
+    if (!waiter->satisfied()) {
+        slot.store(waiter, std::memory_order_release);
+        return;
+    }
+
+    const std::coroutine_handle<> h{waiter->handle_};
+    Executor* const executor{waiter->executor_};
+    if (executor)
+        executor->post(h);
+    else
+        h.resume();
+}
+
+sfap::RingBuffer::Awaiter::Awaiter(RingBuffer& ring, bool read, std::size_t n, Executor* executor) noexcept
+    : ring_(ring), read_(read), needed_(std::min(n, ring.capacity())), executor_(executor) {}
+
+bool sfap::RingBuffer::Awaiter::satisfied() const noexcept {
+    return read_ ? ring_.size() >= needed_ : ring_.free() >= needed_;
+}
+
+bool sfap::RingBuffer::Awaiter::await_ready() const noexcept {
+    return !ring_ || satisfied();
+}
+
+bool sfap::RingBuffer::Awaiter::await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+
+    // Once published, the other side may claim and resume us at any moment,
+    // ending this awaiter's lifetime. Only locals are used past this point.
+    RingBuffer& ring{ring_};
+    const bool read{read_};
+    const std::size_t needed{needed_};
+    Awaiter* self{this};
+
+#if defined(__linux__) && defined(MEMBARRIER_CMD_PRIVATE_EXPEDITED)
+    if (!ring.awaited_.load(std::memory_order_relaxed)) {
+        // Make the other side fence from now on. The barrier runs a full
+        // fence on every thread of the process, so a commit that checked
+        // `awaited_` too early has published its index by the time we look.
+        ring.awaited_.store(true, std::memory_order_seq_cst);
+        ::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+    }
+#endif
+
+    std::atomic<Awaiter*>& slot{read ? ring.read_waiter_ : ring.write_waiter_};
+    slot.store(self, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if ((read ? ring.size() : ring.free()) < needed)
+        return true;
+
+    // Condition became true while registering. Withdraw unless the other
+    // side already claimed us, in which case it will resume us.
+    return !slot.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+}
+
+std::size_t sfap::RingBuffer::Awaiter::await_resume() const noexcept {
+    return read_ ? ring_.size() : ring_.free();
+}
@@ -0,0 +1,140 @@
+/*!
+  \file
+  \brief Shared buffer implementation.
+
+  \details
+  Immutable, atomically reference-counted byte buffer and slices over it for
+  sending the same bytes to many peers without copying.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#include <atomic>
+#include <new>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+
+struct sfap::SharedBuffer::Block {
+    explicit Block(Buffer&& b) noexcept : buffer(std::move(b)) {}
+
+    std::atomic<std::size_t> refs{1};
+    Buffer buffer;
+};
+
+sfap::SharedBuffer::SharedBuffer(Buffer&& buffer) noexcept {
+    if (!buffer)
+        return;
+    // Block's constructor, and so the move, only runs once the allocation succeeded.
+    block_ = new (std::nothrow) Block(std::move(buffer));
+}
+
+sfap::SharedBuffer sfap::SharedBuffer::copy_of(std::span<const std::byte> bytes) noexcept {
+    Buffer buffer{bytes.size()};
+    if (!buffer.assign(bytes))
+        return {};
+    return SharedBuffer{std::move(buffer)};
+}
+
+sfap::SharedBuffer::SharedBuffer(const SharedBuffer& other) noexcept : block_(other.block_) {
+    if (block_)
+        block_->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+sfap::SharedBuffer::SharedBuffer(SharedBuffer&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {}
+
+sfap::SharedBuffer::~SharedBuffer() noexcept {
+    if (block_ && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete block_;
+}
+
+sfap::SharedBuffer& sfap::SharedBuffer::operator=(const SharedBuffer& other) noexcept {
+    if (this != &other) {
+        SharedBuffer copy{other};
+        std::swap(block_, copy.block_);
+    }
+    return *this;
+}
+
+sfap::SharedBuffer& sfap::SharedBuffer::operator=(SharedBuffer&& other) noexcept {
+    if (this != &other) {
+        SharedBuffer old{std::move(*this)};
+        block_ = std::exchange(other.block_, nullptr);
+    }
+    return *this;
+}
+
+sfap::SharedBuffer::operator bool() const noexcept {
+    return block_ != nullptr;
+}
+
+std::size_t sfap::SharedBuffer::size() const noexcept {
+    return block_ ? block_->buffer.size() : 0;
+}
+
+const std::byte* sfap::SharedBuffer::data() const noexcept {
+    return block_ ? block_->buffer.data() : nullptr;
+}
+
+std::span<const std::byte> sfap::SharedBuffer::view() const noexcept {
+    return block_ ? std::as_const(block_->buffer).view() : std::span<const std::byte>{};
+}
+
+std::size_t sfap::SharedBuffer::use_count() const noexcept {
+    return block_ ? block_->refs.load(std::memory_order_relaxed) : 0;
+}
+
+std::optional<sfap::BufferSlice> sfap::SharedBuffer::slice(std::size_t from, std::size_t count) const noexcept {
+    if (!block_)
+        return std::nullopt;
+    if (from > size() || count > size() - from)
+        return std::nullopt;
+
+    return BufferSlice{*this, from, count};
+}
+
+sfap::BufferSlice::BufferSlice(SharedBuffer buffer) noexcept
+    : buffer_(std::move(buffer)), offset_(0), length_(buffer_.size()) {}
+
+sfap::BufferSlice::BufferSlice(SharedBuffer buffer, std::size_t offset, std::size_t length) noexcept
+    : buffer_(std::move(buffer)), offset_(offset), length_(length) {}
+
+sfap::BufferSlice::operator bool() const noexcept {
+    return static_cast<bool>(buffer_);
+}
+
+std::size_t sfap::BufferSlice::size() const noexcept {
+    return length_;
+}
+
+bool sfap::BufferSlice::empty() const noexcept {
+    return length_ == 0;
+}
+
+const std::byte* sfap::BufferSlice::data() const noexcept {
+    return buffer_ ? buffer_.data() + offset_ : nullptr;
+}
+
+std::span<const std::byte> sfap::BufferSlice::view() const noexcept {
+    return buffer_ ? std::span<const std::byte>{buffer_.data() + offset_, length_} : std::span<const std::byte>{};
+}
+
+const sfap::SharedBuffer& sfap::BufferSlice::buffer() const noexcept {
+    return buffer_;
+}
+
+std::optional<sfap::BufferSlice> sfap::BufferSlice::subslice(std::size_t from, std::size_t count) const noexcept {
+    if (!buffer_)
+        return std::nullopt;
+    if (from > length_ || count > length_ - from)
+        return std::nullopt;
+
+    return BufferSlice{buffer_, offset_ + from, count};
+}
@@ -10,40 +10,98 @@
   \note License text intentionally omitted from docs. See repository LICENSE.
 */
 
+#include <new>
 #include <optional>
 #include <span>
 #include <string_view>
+#include <utility>
 
 #include <cstddef>
 #include <cstring>
 
+#include <sfap/utils/buffer.hpp>
 #include <sfap/utils/string.hpp>
 
+namespace {
+
+/// \brief Non-owning Buffer over the characters of \p s, so searches reuse Buffer::find().
+sfap::Buffer view_bytes(const sfap::String& s) noexcept {
+    sfap::Buffer view{std::span<std::byte>{reinterpret_cast<std::byte*>(const_cast<char*>(s.data())), s.size()}};
+    view.resize(s.size());
+    return view;
+}
+
+} // namespace
+
 sfap::String::String(std::string_view source) noexcept : String(source.size()) {
-    if (data_)
+    if (*this)
         assign(source);
 }
 
-sfap::String::String(const char* source) noexcept : data_(source ? std::strlen(source) + 1 : 0) {
-    if (source && data_)
+sfap::String::String(const char* source) noexcept : String(source ? std::strlen(source) : 0) {
+    if (source)
         assign(source);
+    else
+        reset();
 }
 
 sfap::String::String(const String& s) noexcept : String(s.size()) {
-    if (data_)
+    if (*this)
         assign(s.view());
 }
 
-sfap::String::String(std::size_t n) noexcept : data_(n + 1) {
-    resize(0);
+sfap::String::String(std::size_t n) noexcept : size_(0), on_heap_(n > inline_capacity) {
+    if (!on_heap_) {
+        inline_[0] = '\0';
+        return;
+    }
+
+    heap_.data = new (std::nothrow) char[n + 1];
+    heap_.capacity = heap_.data ? n : 0;
+    if (heap_.data)
+        heap_.data[0] = '\0';
+}
+
+sfap::String::~String() noexcept {
+    if (on_heap_)
+        delete[] heap_.data;
+}
+
+sfap::String::String(String&& other) noexcept : size_(0), on_heap_(1) {
+    heap_ = {nullptr, 0};
+    *this = std::move(other);
+}
+
+sfap::String& sfap::String::operator=(String&& other) noexcept {
+    if (this == &other)
+        return *this;
+
+    if (on_heap_)
+        delete[] heap_.data;
+
+    if (other.on_heap_)
+        heap_ = other.heap_;
+    else
+        inline_ = other.inline_;
+    size_ = other.size_;
+    on_heap_ = other.on_heap_;
+
+    other.reset();
+    return *this;
+}
+
+void sfap::String::reset() noexcept {
+    heap_ = {nullptr, 0};
+    size_ = 0;
+    on_heap_ = 1;
 }
 
 sfap::String::operator bool() const noexcept {
-    return static_cast<bool>(data_);
+    return data() != nullptr;
 }
 
 std::size_t sfap::String::capacity() const noexcept {
-    return data_ ? data_.capacity() - 1 : 0;
+    return on_heap_ ? heap_.capacity : inline_capacity;
 }
 
 bool sfap::String::empty() const noexcept {
@@ -51,15 +109,15 @@ bool sfap::String::empty() const noexcept {
 }
 
 std::size_t sfap::String::size() const noexcept {
-    return data_ ? data_.size() - 1 : 0;
+    return size_;
 }
 
 const char* sfap::String::c_str() const noexcept {
-    return data_ ? reinterpret_cast<const char*>(data_.data()) : "";
+    return *this ? data() : "";
 }
 
 std::string_view sfap::String::view() const noexcept {
-    return data_ ? std::string_view{c_str(), size()} : std::string_view{};
+    return *this ? std::string_view{data(), size()} : std::string_view{};
 }
 
 char& sfap::String::operator[](std::size_t i) noexcept {
@@ -71,30 +129,28 @@ const char& sfap::String::operator[](std::size_t i) const noexcept {
 }
 
 std::optional<char> sfap::String::at(std::size_t i) const noexcept {
-    if (!data_ || i >= size())
+    if (!*this || i >= size())
         return std::nullopt;
 
     return data()[i];
 }
 
 bool sfap::String::resize(std::size_t n) noexcept {
-    if (!data_ || n > capacity())
-        return false;
-    if (!data_.resize(n + 1))
+    if (!*this || n > capacity())
         return false;
 
-    data_[size()] = std::byte{0};
+    size_ = n;
+    data()[n] = '\0';
 
     return true;
 }
 
 bool sfap::String::assign(std::string_view source) noexcept {
-    if (!data_ || source.size() > capacity())
-        return false;
-    if (!resize(source.size()))
+    if (!*this || source.size() > capacity())
         return false;
 
-    std::memcpy(data_.data(), source.data(), source.size());
+    std::memcpy(data(), source.data(), source.size());
+    resize(source.size());
 
     return true;
 }
@@ -104,14 +160,11 @@ bool sfap::String::assign(const char* source) noexcept {
 }
 
 bool sfap::String::append(std::string_view source) noexcept {
-    if (!data_ || size() + source.size() > capacity())
+    if (!*this || size() + source.size() > capacity())
         return false;
 
-    const std::size_t old_size = size();
-    if (!resize(size() + source.size()))
-        return false;
-
-    std::memcpy(data_.data() + old_size, source.data(), source.size());
+    std::memcpy(data() + size(), source.data(), source.size());
+    resize(size() + source.size());
 
     return true;
 }
@@ -121,21 +174,17 @@ bool sfap::String::append(const char* source) noexcept {
 }
 
 bool sfap::String::push_back(char ch) noexcept {
-    if (!data_)
-        return false;
-    if (size() >= capacity())
+    if (!*this || size() >= capacity())
         return false;
 
-    if (!resize(size() + 1))
-        return false;
-
-    data_[size() - 1] = static_cast<std::byte>(ch);
+    data()[size()] = ch;
+    resize(size() + 1);
 
     return true;
 }
 
 std::optional<std::string_view> sfap::String::subview(std::size_t from, std::size_t count) const noexcept {
-    if (!data_ || from > size())
+    if (!*this || from > size())
         return std::nullopt;
 
     if (count == 0)
@@ -151,11 +200,11 @@ void sfap::String::clean() noexcept {
 }
 
 char* sfap::String::data() noexcept {
-    return data_ ? reinterpret_cast<char*>(data_.data()) : nullptr;
+    return on_heap_ ? heap_.data : inline_.data();
 }
 
 const char* sfap::String::data() const noexcept {
-    return data_ ? reinterpret_cast<const char*>(data_.data()) : nullptr;
+    return on_heap_ ? heap_.data : inline_.data();
 }
 
 char* sfap::String::begin() noexcept {
@@ -167,27 +216,27 @@ const char* sfap::String::begin() const noexcept {
 }
 
 char* sfap::String::end() noexcept {
-    return data_ ? begin() + size() : nullptr;
+    return *this ? begin() + size() : nullptr;
 }
 
 const char* sfap::String::end() const noexcept {
-    return data_ ? begin() + size() : nullptr;
+    return *this ? begin() + size() : nullptr;
 }
 
 std::optional<std::size_t> sfap::String::find(char c, std::size_t from) const noexcept {
-    if (!data_)
+    if (!*this)
         return std::nullopt;
     if (from >= size())
         return std::nullopt;
 
-    return data_.find(static_cast<std::byte>(c), from);
+    return view_bytes(*this).find(static_cast<std::byte>(c), from);
 }
 
 std::optional<std::size_t> sfap::String::find(std::string_view pattern, std::size_t from) const noexcept {
-    if (!data_)
+    if (!*this)
         return std::nullopt;
     if (from + pattern.size() > size())
         return std::nullopt;
 
-    return data_.find(std::span<const std::byte>{(const std::byte*)pattern.data(), pattern.size()}, from);
-}
\ No newline at end of file
+    return view_bytes(*this).find(std::span<const std::byte>{(const std::byte*)pattern.data(), pattern.size()}, from);
+}
@@ -1,9 +1,16 @@
+#include <map>
 #include <optional>
 #include <string_view>
+#include <unordered_map>
+
+#include <cstring>
 
 #if defined(_WIN32)
 #include <winsock2.h>
 #include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
 #endif
 
 #include <gtest/gtest.h>
@@ -17,6 +24,7 @@ using sfap::errc;
 using sfap::error_code;
 using sfap::String;
 using sfap::net::Address;
+using sfap::net::ip4_t;
 using sfap::net::ipx_t;
 using sfap::net::port_t;
 
@@ -97,6 +105,18 @@ TEST(Address, FromHostnameSetsOriginForRealHostname) {
     EXPECT_EQ(std::string_view("localhost"), origin.value());
 }
 
+TEST(Address, SameHostnameSharesInternedOrigin) {
+    Address a("localhost", 80);
+    Address b(String("localhost"), 443);
+    Address ip("127.0.0.1", 80);
+
+    ASSERT_TRUE(a.get_origin() && b.get_origin());
+    EXPECT_EQ(a.get_origin()->data(), b.get_origin()->data());
+    EXPECT_TRUE(a.same_origin(b));
+    EXPECT_FALSE(a.same_origin(ip));
+    EXPECT_FALSE(ip.same_origin(ip));
+}
+
 TEST(Address, FromHostnameKeepsPortIfAlreadySet) {
     Address addr;
 
@@ -195,4 +215,67 @@ int main(int argc, char** argv) {
 #endif
 
     return result;
-}
\ No newline at end of file
+}
+
+TEST(Address, EqualityOrderingAndHash) {
+    const ipx_t ip{ip4_t{127, 0, 0, 1}};
+    const Address a{ip, 80};
+    const Address b{ip, 80};
+    const Address other_port{ip, 81};
+    const Address named{"localhost", 80};
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, other_port);
+    EXPECT_LT(a, other_port);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_EQ(Address{}, Address{});
+    EXPECT_LT(Address{}, a);
+
+    if (named && named.get_address()->ip_ == ip) {
+        EXPECT_NE(named, a);
+        EXPECT_EQ(named, Address("localhost", 80));
+        EXPECT_EQ(named.hash(), Address("localhost", 80).hash());
+    }
+
+    std::unordered_map<Address, int> counts;
+    ++counts[a];
+    ++counts[b];
+    ++counts[other_port];
+    EXPECT_EQ(counts.size(), 2u);
+    EXPECT_EQ(counts[a], 2);
+
+    std::map<Address, int> ordered{{other_port, 1}, {a, 0}};
+    EXPECT_EQ(ordered.begin()->first, a);
+}
+
+TEST(Address, CachesSocketAddress) {
+    Address empty;
+    EXPECT_EQ(empty.socket_address(), nullptr);
+    EXPECT_EQ(empty.socket_address_size(), 0u);
+
+    Address v4{ipx_t{ip4_t{192, 0, 2, 7}}, 8080};
+    ASSERT_NE(v4.socket_address(), nullptr);
+    ASSERT_EQ(v4.socket_address_size(), sizeof(sockaddr_in));
+    const auto* in4 = reinterpret_cast<const sockaddr_in*>(v4.socket_address());
+    EXPECT_EQ(in4->sin_family, AF_INET);
+    EXPECT_EQ(in4->sin_port, htons(8080));
+    EXPECT_EQ(in4->sin_addr.s_addr, htonl(0xC0000207));
+
+    v4.set_port(443);
+    EXPECT_EQ(in4->sin_port, htons(443));
+
+    const sfap::net::ip6_t bytes{0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x42};
+    v4.from_ip(ipx_t{bytes});
+    ASSERT_EQ(v4.socket_address_size(), sizeof(sockaddr_in6));
+    const auto* in6 = reinterpret_cast<const sockaddr_in6*>(v4.socket_address());
+    EXPECT_EQ(in6->sin6_family, AF_INET6);
+    EXPECT_EQ(in6->sin6_port, htons(443));
+    EXPECT_EQ(std::memcmp(&in6->sin6_addr, bytes.data(), bytes.size()), 0);
+
+    const Address copy{v4};
+    EXPECT_NE(copy.socket_address(), v4.socket_address());
+    EXPECT_EQ(std::memcmp(copy.socket_address(), v4.socket_address(), v4.socket_address_size()), 0);
+
+    v4.clear();
+    EXPECT_EQ(v4.socket_address(), nullptr);
+}
@@ -0,0 +1,79 @@
+#include <span>
+#include <utility>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/types.hpp>
+
+using sfap::net::AddressList;
+using sfap::net::ip4_t;
+using sfap::net::ipx_t;
+
+namespace {
+
+ipx_t nth(int i) {
+    return ipx_t{ip4_t{10, 0, static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i)}};
+}
+
+} // namespace
+
+TEST(AddressList, StaysInlineUpToCapacity) {
+    AddressList list;
+    EXPECT_TRUE(list.empty());
+
+    for (std::size_t i = 0; i < AddressList::inline_capacity; ++i)
+        ASSERT_TRUE(list.push_back(nth(static_cast<int>(i))));
+    EXPECT_EQ(list.size(), AddressList::inline_capacity);
+    EXPECT_EQ(list.capacity(), AddressList::inline_capacity);
+    EXPECT_TRUE(list.contains(nth(3)));
+    EXPECT_FALSE(list.contains(nth(100)));
+}
+
+TEST(AddressList, SpillsToHeapAndKeepsOrder) {
+    AddressList list;
+    for (int i = 0; i < 100; ++i)
+        ASSERT_TRUE(list.push_back(nth(i)));
+
+    EXPECT_EQ(list.size(), 100u);
+    EXPECT_GE(list.capacity(), 100u);
+
+    int i{};
+    for (const ipx_t& ip : list)
+        EXPECT_EQ(ip, nth(i++));
+
+    const std::span<const ipx_t> view{list};
+    EXPECT_EQ(view.size(), 100u);
+    EXPECT_EQ(view[99], nth(99));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_GE(list.capacity(), 100u);
+}
+
+TEST(AddressList, MovesInlineAndHeapStorage) {
+    AddressList small;
+    small.push_back(nth(1));
+    small.push_back(nth(2));
+
+    AddressList moved{std::move(small)};
+    EXPECT_TRUE(small.empty());
+    ASSERT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved[1], nth(2));
+
+    AddressList large;
+    for (int i = 0; i < 40; ++i)
+        large.push_back(nth(i));
+    const ipx_t* storage{large.data()};
+
+    moved = std::move(large);
+    EXPECT_TRUE(large.empty());
+    EXPECT_EQ(moved.size(), 40u);
+    EXPECT_EQ(moved.data(), storage);
+    EXPECT_EQ(moved[39], nth(39));
+
+    large.push_back(nth(7));
+    EXPECT_EQ(large[0], nth(7));
+}
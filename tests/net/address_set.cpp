@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <sfap/net/address.hpp>
+#include <sfap/net/address_set.hpp>
+#include <sfap/net/types.hpp>
+
+using sfap::net::Address;
+using sfap::net::AddressSet;
+using sfap::net::BalancePolicy;
+using sfap::net::ip4_t;
+using sfap::net::ipx_t;
+
+namespace {
+
+std::vector<ipx_t> replicas(int n) {
+    std::vector<ipx_t> ips;
+    for (int i = 0; i < n; ++i)
+        ips.emplace_back(ip4_t{10, 0, 0, static_cast<std::uint8_t>(i + 1)});
+    return ips;
+}
+
+} // namespace
+
+TEST(AddressSet, EmptySetGivesEmptyLeases) {
+    AddressSet set;
+    EXPECT_FALSE(set);
+    EXPECT_FALSE(set.acquire());
+
+    const std::array<Address, 2> empty{};
+    AddressSet skipped{empty};
+    EXPECT_EQ(skipped.size(), 0u);
+    EXPECT_FALSE(skipped.acquire());
+}
+
+TEST(AddressSet, RoundRobinVisitsEveryReplica) {
+    const auto ips = replicas(5);
+    AddressSet set{ips, 443};
+    ASSERT_EQ(set.size(), 5u);
+    EXPECT_EQ(set[2], Address(ips[2], 443));
+
+    for (int round = 0; round < 3; ++round) {
+        for (std::size_t i = 0; i < ips.size(); ++i) {
+            const auto lease = set.acquire();
+            ASSERT_TRUE(lease);
+            EXPECT_EQ(lease.index(), i);
+            EXPECT_EQ(lease.address(), Address(ips[i], 443));
+        }
+    }
+}
+
+TEST(AddressSet, LeasesCountOutstandingWork) {
+    AddressSet set{replicas(2), 80};
+
+    auto first = set.acquire();
+    EXPECT_EQ(set.outstanding(first.index()), 1u);
+
+    AddressSet::Lease moved{std::move(first)};
+    EXPECT_FALSE(first);
+    EXPECT_EQ(set.outstanding(moved.index()), 1u);
+
+    auto second = set.acquire();
+    second = std::move(moved);
+    EXPECT_EQ(set.outstanding(0) + set.outstanding(1), 1u);
+
+    second.release();
+    EXPECT_FALSE(second);
+    EXPECT_EQ(set.outstanding(0) + set.outstanding(1), 0u);
+}
+
+TEST(AddressSet, LeastOutstandingAvoidsBusyReplicas) {
+    AddressSet set{replicas(4), 80, BalancePolicy::LEAST_OUTSTANDING};
+
+    std::vector<AddressSet::Lease> held;
+    for (int i = 0; i < 4; ++i)
+        held.push_back(set.acquire());
+    for (std::size_t i = 0; i < set.size(); ++i)
+        EXPECT_EQ(set.outstanding(i), 1u);
+
+    const std::size_t freed{held[2].index()};
+    held[2].release();
+    for (int i = 0; i < 3; ++i) {
+        auto lease = set.acquire();
+        EXPECT_EQ(lease.index(), freed);
+    }
+}
+
+TEST(AddressSet, PowerOfTwoChoicesStaysBalanced) {
+    AddressSet set{replicas(8), 80, BalancePolicy::POWER_OF_TWO_CHOICES};
+
+    std::vector<AddressSet::Lease> held;
+    for (int i = 0; i < 8000; ++i)
+        held.push_back(set.acquire());
+
+    std::uint32_t low{~0u};
+    std::uint32_t high{};
+    for (std::size_t i = 0; i < set.size(); ++i) {
+        low = std::min(low, set.outstanding(i));
+        high = std::max(high, set.outstanding(i));
+    }
+    EXPECT_LE(high - low, 8u);
+
+    AddressSet single{replicas(1), 80, BalancePolicy::POWER_OF_TWO_CHOICES};
+    EXPECT_EQ(single.acquire().index(), 0u);
+}
+
+TEST(AddressSet, ConcurrentAcquireRelease) {
+    for (const auto policy :
+         {BalancePolicy::ROUND_ROBIN, BalancePolicy::POWER_OF_TWO_CHOICES, BalancePolicy::LEAST_OUTSTANDING}) {
+        AddressSet set{replicas(16), 80, policy};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < 20000; ++i) {
+                    auto lease = set.acquire();
+                    EXPECT_LT(lease.index(), set.size());
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        for (std::size_t i = 0; i < set.size(); ++i)
+            EXPECT_EQ(set.outstanding(i), 0u);
+    }
+}
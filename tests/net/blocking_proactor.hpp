@@ -0,0 +1,192 @@
+/*!
+  \file
+  \brief Synchronous Proactor for tests of the proactor-generic code.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/socket_options.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+namespace test {
+
+/*!
+  \brief Proactor doing every operation synchronously on blocking sockets.
+  \details Lets Proactor::resolve() and friends run on any platform. Every
+           task but sleep_for() completes before start_detached() returns, so
+           nothing is ever in flight for cancel(). Timers only expire when the
+           test calls fire_timers().
+*/
+class BlockingProactor final : public sfap::net::Proactor {
+  public:
+    ~BlockingProactor() override {
+        for (const auto& [id, fd] : sockets_)
+            ::close(fd);
+    }
+
+    operator bool() const noexcept override {
+        return true;
+    }
+    sfap::error_code get_error() const noexcept override {
+        return sfap::no_error();
+    }
+    void run() noexcept override {}
+    void stop() noexcept override {}
+    void post(std::coroutine_handle<> h) noexcept override {
+        h.resume();
+    }
+
+    sfap::task<sfap::result<sfap::net::Socket>> connect(const sfap::net::Address& address, duration timeout,
+                                                        const sfap::net::SocketOptions& options) noexcept override {
+        auto socket = open_stream(address, options);
+        if (!socket)
+            co_return sfap::unexpected<sfap::error_code>(socket.error());
+        if (const auto error = co_await socket_connect(socket->get_handle(), address, timeout))
+            co_return sfap::unexpected<sfap::error_code>(error);
+        co_return std::move(socket);
+    }
+
+    sfap::result<sfap::net::Socket> open_stream(const sfap::net::Address& peer,
+                                                const sfap::net::SocketOptions& options) noexcept override {
+        const int fd{::socket(peer.socket_address()->sa_family, SOCK_STREAM, 0)};
+        if (fd < 0)
+            return sfap::network_error();
+        if (const auto error = sfap::net::apply_socket_options(fd, options)) {
+            ::close(fd);
+            return sfap::unexpected<sfap::error_code>(error);
+        }
+        return add(fd);
+    }
+
+    sfap::task<sfap::error_code> socket_connect(sfap::net::socket_t id, const sfap::net::Address& address,
+                                                duration) noexcept override {
+        if (::connect(sockets_.at(id), address.socket_address(), address.socket_address_size()) != 0)
+            co_return sfap::network_error().error();
+        co_return sfap::no_error();
+    }
+
+    void cancel(sfap::net::socket_t) noexcept override {}
+
+    bool socket_alive(sfap::net::socket_t id) noexcept override {
+        std::byte probe;
+        const ssize_t n{::recv(sockets_.at(id), &probe, 1, MSG_PEEK | MSG_DONTWAIT)};
+        return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+
+    sfap::result<sfap::net::Socket> connect_datagram(const sfap::net::Address& peer) noexcept override {
+        const int fd{::socket(peer.socket_address()->sa_family, SOCK_DGRAM, 0)};
+        if (::connect(fd, peer.socket_address(), peer.socket_address_size()) != 0) {
+            const auto error{sfap::network_error()};
+            ::close(fd);
+            return error;
+        }
+        return add(fd);
+    }
+
+    void close(sfap::net::socket_t id) noexcept override {
+        if (const auto it = sockets_.find(id); it != sockets_.end()) {
+            ::close(it->second);
+            sockets_.erase(it);
+        }
+    }
+
+    /// \brief Parks the caller until fire_timers(); the duration is ignored.
+    sfap::task<sfap::error_code> sleep_for(duration) noexcept override {
+        struct Park {
+            std::vector<std::coroutine_handle<>>& timers;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+            void await_suspend(std::coroutine_handle<> h) noexcept {
+                timers.push_back(h);
+            }
+            void await_resume() const noexcept {}
+        };
+
+        co_await Park{timers_};
+        co_return sfap::no_error();
+    }
+
+    /// \brief Expire every pending sleep_for().
+    /// \return Number of timers fired.
+    std::size_t fire_timers() {
+        std::vector<std::coroutine_handle<>> due;
+        due.swap(timers_);
+        for (const auto h : due)
+            h.resume();
+        return due.size();
+    }
+
+    sfap::task<sfap::result<std::size_t>> socket_send(sfap::net::socket_t id,
+                                                      std::span<const std::byte> data) noexcept override {
+        const ssize_t n{::send(sockets_.at(id), data.data(), data.size(), MSG_NOSIGNAL)};
+        if (n < 0)
+            co_return sfap::network_error();
+        co_return static_cast<std::size_t>(n);
+    }
+
+    sfap::task<sfap::result<std::size_t>>
+    socket_sendv(sfap::net::socket_t id, std::span<const std::span<const std::byte>> data) noexcept override {
+        co_return co_await socket_send(id, data.front());
+    }
+
+    sfap::task<sfap::result<std::size_t>> socket_recv(sfap::net::socket_t id,
+                                                      std::span<std::byte> data) noexcept override {
+        co_return co_await socket_recv_for(id, data, std::chrono::seconds{10});
+    }
+
+    sfap::task<sfap::result<std::size_t>> socket_recv_for(sfap::net::socket_t id, std::span<std::byte> data,
+                                                          duration timeout) noexcept override {
+        pollfd fd{sockets_.at(id), POLLIN, 0};
+        const auto ms{std::chrono::ceil<std::chrono::milliseconds>(timeout).count()};
+        if (::poll(&fd, 1, static_cast<int>(ms)) == 0)
+            co_return sfap::network_error(ETIMEDOUT);
+        const ssize_t n{::recv(fd.fd, data.data(), data.size(), 0)};
+        if (n < 0)
+            co_return sfap::network_error();
+        co_return static_cast<std::size_t>(n);
+    }
+
+    /// \return Descriptor behind socket \p id, `-1` if unknown.
+    int descriptor(sfap::net::socket_t id) const noexcept {
+        const auto it{sockets_.find(id)};
+        return it == sockets_.end() ? -1 : it->second;
+    }
+
+  private:
+    sfap::net::Socket add(int fd) {
+        const sfap::net::socket_t id{next_++};
+        sockets_.emplace(id, fd);
+        return sfap::net::Socket{this, id};
+    }
+
+    sfap::net::socket_t next_{1};
+    std::unordered_map<sfap::net::socket_t, int> sockets_;
+    std::vector<std::coroutine_handle<>> timers_;
+};
+
+} // namespace test
@@ -0,0 +1,152 @@
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <cerrno>
+#include <cstdint>
+
+#include <sys/socket.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/dns.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+#include "blocking_proactor.hpp"
+#include "listener.hpp"
+
+using sfap::net::ResolveMode;
+using sfap::net::Socket;
+using sfap::net::dns::Config;
+using test::BlockingProactor;
+using test::Listener;
+
+namespace {
+
+Config dual_stack(std::string_view host) {
+    Config config;
+    std::string hosts{"127.0.0.1 "};
+    hosts.append(host);
+    hosts.append("\n::1 ");
+    hosts.append(host);
+    hosts.append("\n");
+    config.hosts.parse(hosts);
+    return config;
+}
+
+sfap::result<Socket> connect_any(BlockingProactor& proactor, std::string_view host, std::uint16_t port,
+                                 ResolveMode mode, const Config& config) {
+    sfap::result<Socket> out{sfap::generic_error(sfap::errc::INVALID_ARGUMENT)};
+    auto body = [&]() -> sfap::task<void> {
+        out = co_await proactor.connect_any(host, port, mode, sfap::net::Proactor::duration::max(), config);
+    };
+    auto task = body();
+    task.start_detached();
+    return out;
+}
+
+/// \return Address family of the peer of \p socket.
+int peer_family(const BlockingProactor& proactor, const Socket& socket) {
+    sockaddr_storage peer{};
+    socklen_t size{sizeof(peer)};
+    if (::getpeername(proactor.descriptor(socket.get_handle()), reinterpret_cast<sockaddr*>(&peer), &size) != 0)
+        return AF_UNSPEC;
+    return peer.ss_family;
+}
+
+} // namespace
+
+TEST(ConnectAny, ConnectsToLiteral) {
+    Listener v4{AF_INET, 0};
+    ASSERT_TRUE(v4);
+    BlockingProactor proactor;
+
+    const auto socket = connect_any(proactor, "127.0.0.1", v4.port(), ResolveMode::PREFER_IPV6, Config{});
+    ASSERT_TRUE(socket);
+    EXPECT_EQ(peer_family(proactor, *socket), AF_INET);
+}
+
+TEST(ConnectAny, StartsWithPreferredFamily) {
+    Listener v4{AF_INET, 0};
+    ASSERT_TRUE(v4);
+    Listener v6{AF_INET6, v4.port()};
+    if (!v6)
+        GTEST_SKIP() << "IPv6 loopback unavailable";
+    BlockingProactor proactor;
+
+    const auto first = connect_any(proactor, "prefer6.test", v4.port(), ResolveMode::PREFER_IPV6,
+                                   dual_stack("prefer6.test"));
+    ASSERT_TRUE(first);
+    EXPECT_EQ(peer_family(proactor, *first), AF_INET6);
+
+    const auto second = connect_any(proactor, "prefer4.test", v4.port(), ResolveMode::PREFER_IPV4,
+                                    dual_stack("prefer4.test"));
+    ASSERT_TRUE(second);
+    EXPECT_EQ(peer_family(proactor, *second), AF_INET);
+}
+
+TEST(ConnectAny, FallsBackToOtherFamily) {
+    Listener v4{AF_INET, 0};
+    ASSERT_TRUE(v4);
+    BlockingProactor proactor;
+
+    // Nothing listens on [::1]:port, so the IPv6 attempt is refused.
+    const auto socket = connect_any(proactor, "fallback.test", v4.port(), ResolveMode::PREFER_IPV6,
+                                    dual_stack("fallback.test"));
+    ASSERT_TRUE(socket);
+    EXPECT_EQ(peer_family(proactor, *socket), AF_INET);
+}
+
+TEST(ConnectAny, RemembersWinningFamily) {
+    Listener v4{AF_INET, 0};
+    ASSERT_TRUE(v4);
+    BlockingProactor proactor;
+
+    const auto first = connect_any(proactor, "memory.test", v4.port(), ResolveMode::PREFER_IPV6,
+                                   dual_stack("memory.test"));
+    ASSERT_TRUE(first);
+    EXPECT_EQ(peer_family(proactor, *first), AF_INET);
+
+    Listener v6{AF_INET6, v4.port()};
+    if (!v6)
+        GTEST_SKIP() << "IPv6 loopback unavailable";
+
+    // IPv6 works now, but IPv4 won last time for this host.
+    const auto second = connect_any(proactor, "memory.test", v4.port(), ResolveMode::PREFER_IPV6,
+                                    dual_stack("memory.test"));
+    ASSERT_TRUE(second);
+    EXPECT_EQ(peer_family(proactor, *second), AF_INET);
+
+    const auto fresh = connect_any(proactor, "fresh.test", v4.port(), ResolveMode::PREFER_IPV6,
+                                   dual_stack("fresh.test"));
+    ASSERT_TRUE(fresh);
+    EXPECT_EQ(peer_family(proactor, *fresh), AF_INET6);
+}
+
+TEST(ConnectAny, ReportsLastErrorWhenEveryAttemptFails) {
+    std::uint16_t port{};
+    {
+        Listener unused{AF_INET, 0};
+        ASSERT_TRUE(unused);
+        port = unused.port();
+    }
+    BlockingProactor proactor;
+
+    const auto socket = connect_any(proactor, "nobody.test", port, ResolveMode::PREFER_IPV6,
+                                    dual_stack("nobody.test"));
+    ASSERT_FALSE(socket);
+    EXPECT_EQ(socket.error().code(), ECONNREFUSED);
+}
+
+TEST(ConnectAny, ReportsResolutionError) {
+    BlockingProactor proactor;
+
+    const auto socket = connect_any(proactor, "bad..name", 80, ResolveMode::PREFER_IPV4, Config{});
+    ASSERT_FALSE(socket);
+    EXPECT_EQ(socket.error().code(), static_cast<int>(sfap::errc::INVALID_ARGUMENT));
+}
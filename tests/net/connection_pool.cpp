@@ -0,0 +1,277 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/connection_pool.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+#include "blocking_proactor.hpp"
+#include "listener.hpp"
+
+using namespace std::chrono_literals;
+
+using sfap::net::Address;
+using sfap::net::ConnectionPool;
+using sfap::net::ConnectionPoolOptions;
+using test::BlockingProactor;
+using test::Listener;
+
+namespace {
+
+ConnectionPoolOptions manual() {
+    ConnectionPoolOptions options;
+    options.maintenance_interval = ConnectionPoolOptions::duration::zero();
+    return options;
+}
+
+/// \brief acquire() kept running so tests can look at it while it waits.
+struct Acquire {
+    Acquire(ConnectionPool& pool, const Address& address) {
+        task = [](ConnectionPool& p, Address a, std::optional<sfap::result<ConnectionPool::Lease>>& out)
+            -> sfap::task<void> { out.emplace(co_await p.acquire(a)); }(pool, address, lease);
+        task.start_detached();
+    }
+
+    std::optional<sfap::result<ConnectionPool::Lease>> lease;
+    sfap::task<void> task;
+};
+
+std::size_t prewarm(ConnectionPool& pool, const Address& address, std::size_t count) {
+    std::size_t out{};
+    auto body = [&]() -> sfap::task<void> { out = co_await pool.prewarm(address, count); };
+    auto task = body();
+    task.start_detached();
+    return out;
+}
+
+} // namespace
+
+TEST(ConnectionPool, ReusesReleasedConnection) {
+    Listener listener;
+    BlockingProactor proactor;
+    ConnectionPool pool{proactor, manual()};
+
+    Acquire first{pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease);
+    const auto handle = (*first.lease)->socket().get_handle();
+    (*first.lease)->release();
+    EXPECT_EQ(pool.idle(listener.address()), 1u);
+
+    Acquire second{pool, listener.address()};
+    ASSERT_TRUE(second.lease && *second.lease);
+    EXPECT_EQ((*second.lease)->socket().get_handle(), handle);
+    EXPECT_EQ(pool.idle(listener.address()), 0u);
+
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.connected, 1u);
+    EXPECT_EQ(stats.reused, 1u);
+    EXPECT_EQ(stats.leased, 1u);
+}
+
+TEST(ConnectionPool, DiscardedConnectionIsNotReused) {
+    Listener listener;
+    BlockingProactor proactor;
+    ConnectionPool pool{proactor, manual()};
+
+    Acquire first{pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease);
+    (*first.lease)->discard();
+    EXPECT_FALSE(**first.lease);
+    EXPECT_EQ(pool.idle(listener.address()), 0u);
+
+    Acquire second{pool, listener.address()};
+    ASSERT_TRUE(second.lease && *second.lease);
+    EXPECT_EQ(pool.stats().connected, 2u);
+}
+
+TEST(ConnectionPool, SkipsIdleConnectionClosedByPeer) {
+    Listener listener;
+    BlockingProactor proactor;
+    ConnectionPool pool{proactor, manual()};
+
+    {
+        Acquire first{pool, listener.address()};
+        ASSERT_TRUE(first.lease && *first.lease);
+    }
+    ASSERT_EQ(pool.idle(listener.address()), 1u);
+    ::close(listener.accept());
+
+    Acquire second{pool, listener.address()};
+    ASSERT_TRUE(second.lease && *second.lease);
+
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.dead, 1u);
+    EXPECT_EQ(stats.reused, 0u);
+    EXPECT_EQ(stats.connected, 2u);
+}
+
+TEST(ConnectionPool, WaitsAtPerHostLimit) {
+    Listener listener;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.max_per_host = 1;
+    ConnectionPool pool{proactor, options};
+
+    Acquire first{pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease);
+
+    Acquire second{pool, listener.address()};
+    EXPECT_FALSE(second.lease);
+
+    (*first.lease)->release();
+    ASSERT_TRUE(second.lease && *second.lease);
+
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.connected, 1u);
+    EXPECT_EQ(stats.waited, 1u);
+
+    // A discarded connection frees the slot, so the next waiter connects anew.
+    Acquire third{pool, listener.address()};
+    EXPECT_FALSE(third.lease);
+    (*second.lease)->discard();
+    ASSERT_TRUE(third.lease && *third.lease);
+    EXPECT_EQ(pool.stats().connected, 2u);
+}
+
+TEST(ConnectionPool, KeepsAtMostMaxIdle) {
+    Listener listener;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.max_idle_per_host = 1;
+    ConnectionPool pool{proactor, options};
+
+    Acquire first{pool, listener.address()};
+    Acquire second{pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease && second.lease && *second.lease);
+    (*first.lease)->release();
+    (*second.lease)->release();
+    EXPECT_EQ(pool.idle(listener.address()), 1u);
+}
+
+TEST(ConnectionPool, EvictsExpiredIdleConnections) {
+    Listener listener;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.idle_timeout = 1ms;
+    ConnectionPool pool{proactor, options};
+
+    {
+        Acquire first{pool, listener.address()};
+        ASSERT_TRUE(first.lease && *first.lease);
+    }
+    ASSERT_EQ(pool.idle(listener.address()), 1u);
+
+    std::this_thread::sleep_for(5ms);
+    pool.evict_idle();
+    EXPECT_EQ(pool.idle(listener.address()), 0u);
+    EXPECT_EQ(pool.stats().expired, 1u);
+}
+
+TEST(ConnectionPool, TracksManyPeers) {
+    std::array<Listener, 40> listeners;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.idle_timeout = 1ms;
+    ConnectionPool pool{proactor, options};
+
+    for (const auto& listener : listeners) {
+        Acquire lease{pool, listener.address()};
+        ASSERT_TRUE(lease.lease && *lease.lease);
+    }
+    for (const auto& listener : listeners)
+        EXPECT_EQ(pool.idle(listener.address()), 1u);
+    EXPECT_EQ(pool.stats().idle, listeners.size());
+
+    // Evicting drops the idle connections and then the peers themselves.
+    std::this_thread::sleep_for(5ms);
+    pool.evict_idle();
+    pool.evict_idle();
+    for (const auto& listener : listeners)
+        EXPECT_EQ(pool.idle(listener.address()), 0u);
+
+    Acquire again{pool, listeners.back().address()};
+    ASSERT_TRUE(again.lease && *again.lease);
+    EXPECT_EQ(pool.stats().connected, listeners.size() + 1);
+}
+
+TEST(ConnectionPool, PrewarmStaysWithinLimits) {
+    Listener listener;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.max_per_host = 2;
+    ConnectionPool pool{proactor, options};
+
+    EXPECT_EQ(prewarm(pool, listener.address(), 3), 2u);
+    EXPECT_EQ(pool.idle(listener.address()), 2u);
+    EXPECT_EQ(prewarm(pool, listener.address(), 3), 0u);
+
+    Acquire first{pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease);
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.prewarmed, 2u);
+    EXPECT_EQ(stats.reused, 1u);
+    EXPECT_EQ(stats.connected, 0u);
+}
+
+TEST(ConnectionPool, MaintenancePrewarmsHotPeers) {
+    Listener listener;
+    BlockingProactor proactor;
+    ConnectionPoolOptions options;
+    options.prewarm_idle = 3;
+    options.hot_acquires = 2;
+    {
+        ConnectionPool pool{proactor, options};
+
+        for (int i = 0; i < 2; ++i) {
+            Acquire lease{pool, listener.address()};
+            ASSERT_TRUE(lease.lease && *lease.lease);
+        }
+        EXPECT_EQ(pool.idle(listener.address()), 1u);
+
+        EXPECT_EQ(proactor.fire_timers(), 1u);
+        EXPECT_EQ(pool.idle(listener.address()), 3u);
+        EXPECT_EQ(pool.stats().prewarmed, 2u);
+
+        // No acquires since the last pass: the peer cooled down.
+        EXPECT_EQ(proactor.fire_timers(), 1u);
+        EXPECT_EQ(pool.stats().prewarmed, 2u);
+    }
+
+    // The timer notices the pool is gone and stops.
+    EXPECT_EQ(proactor.fire_timers(), 1u);
+    EXPECT_EQ(proactor.fire_timers(), 0u);
+}
+
+TEST(ConnectionPool, OutlivedLeasesAndWaitersEndCleanly) {
+    Listener listener;
+    BlockingProactor proactor;
+    auto options = manual();
+    options.max_per_host = 1;
+
+    std::optional<ConnectionPool> pool{std::in_place, proactor, options};
+    Acquire first{*pool, listener.address()};
+    ASSERT_TRUE(first.lease && *first.lease);
+    Acquire second{*pool, listener.address()};
+    EXPECT_FALSE(second.lease);
+
+    pool.reset();
+    ASSERT_TRUE(second.lease);
+    ASSERT_FALSE(*second.lease);
+    EXPECT_EQ(second.lease->error().code(), ECANCELED);
+
+    // Closes the connection instead of returning it.
+    (*first.lease)->release();
+}
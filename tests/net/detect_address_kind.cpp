@@ -129,4 +129,20 @@ TEST(detect_address_kind, EmbeddedNul_IPv4_TreatedAsIPv4) {
 
     ASSERT_TRUE(r);
     EXPECT_EQ(*r, AddressKind::IP4);
-}
\ No newline at end of file
+}
+
+TEST(detect_address_kind, Hostname_LabelRules) {
+    for (const char* valid : {"localhost", "a.bc", "a-b.example.com", "0.example.org", "host.xn--p1ai", "numeric.tld9.",
+                              "a.b.c.d.e.f.g.h.io"}) {
+        const auto r = detect_address_kind(valid);
+        ASSERT_TRUE(r);
+        EXPECT_EQ(*r, AddressKind::HOSTNAME) << valid;
+    }
+
+    for (const char* invalid : {"-a.com", "a-.com", "a..com", ".com", "a.c", "a.c0m", "a.xn--",
+                                "under_score.com", "sp ace.com", "caf\xc3\xa9.com", "."}) {
+        const auto r = detect_address_kind(invalid);
+        ASSERT_TRUE(r);
+        EXPECT_EQ(*r, AddressKind::UNKNOWN) << invalid;
+    }
+}
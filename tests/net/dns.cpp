@@ -0,0 +1,600 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address_list.hpp>
+#include <sfap/net/dns.hpp>
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/proactor.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+#include "blocking_proactor.hpp"
+
+using namespace std::chrono_literals;
+using namespace sfap::net::literals;
+
+using sfap::net::Address;
+using sfap::net::ipx_t;
+using test::BlockingProactor;
+using sfap::net::ResolveMode;
+using sfap::net::dns::Config;
+using sfap::net::dns::Hosts;
+using sfap::net::dns::Type;
+
+namespace {
+
+std::vector<std::string> names(const Config::Candidates& candidates) {
+    std::vector<std::string> out;
+    for (const sfap::net::dns::Name& name : candidates)
+        out.emplace_back(name.view());
+    return out;
+}
+
+std::vector<std::string> names(std::span<const sfap::net::dns::Name> domains) {
+    std::vector<std::string> out;
+    for (const sfap::net::dns::Name& name : domains)
+        out.emplace_back(name.view());
+    return out;
+}
+
+std::vector<std::byte> bytes(std::initializer_list<int> values) {
+    std::vector<std::byte> out;
+    for (const int v : values)
+        out.push_back(static_cast<std::byte>(v));
+    return out;
+}
+
+/// \brief Minimal DNS message writer for building server responses.
+struct Message {
+    std::vector<std::byte> data;
+
+    void u8(unsigned v) {
+        data.push_back(static_cast<std::byte>(v));
+    }
+    void u16(unsigned v) {
+        u8(v >> 8);
+        u8(v & 0xFF);
+    }
+    void u32(std::uint32_t v) {
+        u16(v >> 16);
+        u16(v & 0xFFFF);
+    }
+    void name(std::string_view text) {
+        while (!text.empty()) {
+            const std::size_t dot{std::min(text.find('.'), text.size())};
+            u8(static_cast<unsigned>(dot));
+            for (const char c : text.substr(0, dot))
+                u8(static_cast<unsigned char>(c));
+            text.remove_prefix(std::min(dot + 1, text.size()));
+        }
+        u8(0);
+    }
+    void raw(std::span<const std::byte> more) {
+        data.insert(data.end(), more.begin(), more.end());
+    }
+};
+
+struct Record {
+    std::uint16_t type;
+    std::vector<std::byte> rdata;
+    std::string owner{}; ///< Empty: pointer to the question name.
+    std::uint32_t ttl{300};
+};
+
+std::vector<std::byte> ip_rdata(const ipx_t& ip) {
+    if (ip.is_4()) {
+        const auto v4 = ip.get_4();
+        return {reinterpret_cast<const std::byte*>(v4.data()), reinterpret_cast<const std::byte*>(v4.data()) + 4};
+    }
+    const auto& v6 = ip.get_6();
+    return {reinterpret_cast<const std::byte*>(v6.data()), reinterpret_cast<const std::byte*>(v6.data()) + 16};
+}
+
+/// \brief Answer \p query, which must be a plain single-question query.
+std::vector<std::byte> respond(std::span<const std::byte> query, unsigned flags, const std::vector<Record>& answers,
+                               int id_delta = 0) {
+    Message m;
+    const unsigned id{(std::to_integer<unsigned>(query[0]) << 8) | std::to_integer<unsigned>(query[1])};
+    m.u16(static_cast<std::uint16_t>(id + id_delta));
+    m.u16(0x8180 | flags);
+    m.u16(1);
+    m.u16(static_cast<unsigned>(answers.size()));
+    m.u16(0);
+    m.u16(0);
+    m.raw(query.subspan(12));
+    for (const Record& r : answers) {
+        if (r.owner.empty())
+            m.u16(0xC00C);
+        else
+            m.name(r.owner);
+        m.u16(r.type);
+        m.u16(1);
+        m.u32(r.ttl);
+        m.u16(static_cast<unsigned>(r.rdata.size()));
+        m.raw(r.rdata);
+    }
+    return m.data;
+}
+
+std::pair<std::string, std::uint16_t> question(std::span<const std::byte> query) {
+    std::string name;
+    std::size_t at{12};
+    while (const unsigned length = std::to_integer<unsigned>(query[at])) {
+        if (!name.empty())
+            name.push_back('.');
+        for (unsigned i = 0; i < length; ++i)
+            name.push_back(static_cast<char>(query[at + 1 + i]));
+        at += 1 + length;
+    }
+    ++at;
+    return {name, static_cast<std::uint16_t>((std::to_integer<unsigned>(query[at]) << 8) |
+                                             std::to_integer<unsigned>(query[at + 1]))};
+}
+
+/*!
+  \brief Authoritative-looking DNS server on 127.0.0.1 answering over UDP and TCP.
+
+  - www.example.test, alias.example.test (CNAME), v4only.example.test,
+    host.corp.test and spoof.example.test (stray answer first) resolve;
+  - big.example.test is truncated over UDP and answered with 20 records over TCP;
+  - silent.example.test is never answered; everything else is NXDOMAIN.
+*/
+class StubServer {
+  public:
+    StubServer() {
+        udp_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        EXPECT_EQ(::bind(udp_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        socklen_t len{sizeof(addr)};
+        ::getsockname(udp_, reinterpret_cast<sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+
+        tcp_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        const int one{1};
+        ::setsockopt(tcp_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        EXPECT_EQ(::bind(tcp_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        EXPECT_EQ(::listen(tcp_, 4), 0);
+
+        thread_ = std::thread([this] { serve(); });
+    }
+
+    ~StubServer() {
+        stop_ = true;
+        thread_.join();
+        ::close(udp_);
+        ::close(tcp_);
+    }
+
+    Address address() const {
+        return Address{"127.0.0.1"_ip, port_};
+    }
+
+    int queries() const {
+        return queries_;
+    }
+
+    int tcp_queries() const {
+        return tcp_queries_;
+    }
+
+  private:
+    std::vector<std::vector<std::byte>> answer(std::span<const std::byte> query, bool tcp) {
+        const auto [name, type] = question(query);
+        const bool a{type == 1};
+
+        if (name == "www.example.test" || name == "host.corp.test")
+            return {respond(query, 0, {{type, ip_rdata(a ? "192.0.2.10"_ip : "2001:db8::10"_ip)}})};
+        if (name == "alias.example.test") {
+            Message target;
+            target.name("www.example.test");
+            return {respond(query, 0,
+                            {{5, target.data},
+                             {type, ip_rdata(a ? "192.0.2.11"_ip : "2001:db8::11"_ip), "www.example.test"}})};
+        }
+        if (name == "v4only.example.test")
+            return {respond(query, 0, a ? std::vector<Record>{{1, ip_rdata("192.0.2.12"_ip)}} : std::vector<Record>{})};
+        if (name == "spoof.example.test")
+            return {respond(query, 0, {{type, ip_rdata(a ? "203.0.113.66"_ip : "2001:db8::66"_ip)}}, 1),
+                    respond(query, 0, {{type, ip_rdata(a ? "192.0.2.13"_ip : "2001:db8::13"_ip)}})};
+        if (name == "big.example.test") {
+            if (!tcp)
+                return {respond(query, 0x0200, {})};
+            std::vector<Record> records;
+            for (int i = 0; i < 20; ++i)
+                records.push_back({1, bytes({198, 51, 100, i + 1})});
+            return {respond(query, 0, a ? records : std::vector<Record>{})};
+        }
+        if (name == "silent.example.test")
+            return {};
+        return {respond(query, 3, {})};
+    }
+
+    void serve() {
+        std::array<std::byte, 512> buffer;
+        while (!stop_) {
+            pollfd fds[2]{{udp_, POLLIN, 0}, {tcp_, POLLIN, 0}};
+            if (::poll(fds, 2, 20) <= 0)
+                continue;
+
+            if (fds[0].revents & POLLIN) {
+                sockaddr_in peer{};
+                socklen_t len{sizeof(peer)};
+                const ssize_t n{::recvfrom(udp_, buffer.data(), buffer.size(), 0, reinterpret_cast<sockaddr*>(&peer),
+                                           &len)};
+                if (n > 0) {
+                    ++queries_;
+                    for (const auto& reply : answer({buffer.data(), static_cast<std::size_t>(n)}, false))
+                        ::sendto(udp_, reply.data(), reply.size(), 0, reinterpret_cast<sockaddr*>(&peer), len);
+                }
+            }
+
+            if (fds[1].revents & POLLIN) {
+                const int client{::accept(tcp_, nullptr, nullptr)};
+                std::array<unsigned char, 2> prefix;
+                if (::recv(client, prefix.data(), 2, MSG_WAITALL) == 2) {
+                    const std::size_t size{(std::size_t{prefix[0]} << 8) | prefix[1]};
+                    if (::recv(client, buffer.data(), size, MSG_WAITALL) == static_cast<ssize_t>(size)) {
+                        ++tcp_queries_;
+                        for (const auto& reply : answer({buffer.data(), size}, true)) {
+                            const unsigned char length[2]{static_cast<unsigned char>(reply.size() >> 8),
+                                                          static_cast<unsigned char>(reply.size())};
+                            ::send(client, length, 2, 0);
+                            ::send(client, reply.data(), reply.size(), 0);
+                        }
+                    }
+                }
+                ::close(client);
+            }
+        }
+    }
+
+    int udp_{-1};
+    int tcp_{-1};
+    std::uint16_t port_{};
+    std::atomic<bool> stop_{false};
+    std::atomic<int> queries_{0};
+    std::atomic<int> tcp_queries_{0};
+    std::thread thread_;
+};
+
+sfap::result<ipx_t> resolve(sfap::net::Proactor& proactor, std::string_view host, ResolveMode mode,
+                            const Config& config) {
+    sfap::result<ipx_t> out{sfap::generic_error(sfap::errc::INVALID_ARGUMENT)};
+    auto body = [&]() -> sfap::task<void> { out = co_await proactor.resolve(host, mode, config); };
+    auto task = body();
+    task.start_detached();
+    return out;
+}
+
+sfap::result<sfap::net::AddressList> resolve_all(sfap::net::Proactor& proactor, std::string_view host,
+                                                ResolveMode mode, const Config& config) {
+    sfap::result<sfap::net::AddressList> out{sfap::generic_error(sfap::errc::INVALID_ARGUMENT)};
+    auto body = [&]() -> sfap::task<void> { out = co_await proactor.resolve_all(host, mode, config); };
+    auto task = body();
+    task.start_detached();
+    return out;
+}
+
+Config stub_config(const StubServer& server) {
+    Config config;
+    config.add_nameserver(server.address());
+    config.timeout = 500ms;
+    config.attempts = 1;
+    return config;
+}
+
+} // namespace
+
+TEST(Dns, EncodeQuery) {
+    std::array<std::byte, 512> out;
+    const auto size = sfap::net::dns::encode_query(out, 0x1234, "a.bc.", Type::A);
+    ASSERT_TRUE(size);
+
+    const auto expected = bytes({0x12, 0x34, 0x01, 0x00, 0x00, 0x01, 0, 0, 0, 0, 0, 0, 1, 'a', 2, 'b', 'c', 0, 0, 1, 0,
+                                 1});
+    EXPECT_EQ(std::vector<std::byte>(out.begin(), out.begin() + *size), expected);
+
+    const auto aaaa = sfap::net::dns::encode_query(out, 1, "example.test", Type::AAAA);
+    ASSERT_TRUE(aaaa);
+    EXPECT_EQ(std::to_integer<int>(out[*aaaa - 3]), 28);
+}
+
+TEST(Dns, EncodeQueryRejectsBadNames) {
+    std::array<std::byte, 512> out;
+    EXPECT_FALSE(sfap::net::dns::encode_query(out, 1, "", Type::A));
+    EXPECT_FALSE(sfap::net::dns::encode_query(out, 1, ".", Type::A));
+    EXPECT_FALSE(sfap::net::dns::encode_query(out, 1, "a..b", Type::A));
+    EXPECT_FALSE(sfap::net::dns::encode_query(out, 1, std::string(64, 'a') + ".test", Type::A));
+    EXPECT_TRUE(sfap::net::dns::encode_query(out, 1, std::string(63, 'a') + ".test", Type::A));
+
+    std::string long_name;
+    while (long_name.size() < 254)
+        long_name += "abcdefg.";
+    EXPECT_FALSE(sfap::net::dns::encode_query(out, 1, long_name.substr(0, 254), Type::A));
+    EXPECT_FALSE(sfap::net::dns::encode_query(std::span{out}.first(20), 1, "example.test", Type::A));
+}
+
+TEST(Dns, DecodeResponseFollowsCompressionAndCname) {
+    std::array<std::byte, 512> query;
+    const auto size = sfap::net::dns::encode_query(query, 0xBEEF, "alias.example.test", Type::A);
+    ASSERT_TRUE(size);
+
+    Message target;
+    target.name("www.example.test");
+    const auto message = respond({query.data(), *size}, 0,
+                                 {{5, target.data, "", 600},
+                                  {1, ip_rdata("192.0.2.1"_ip), "www.example.test", 120},
+                                  {28, ip_rdata("2001:db8::1"_ip), "www.example.test"},
+                                  {1, ip_rdata("192.0.2.2"_ip), "www.example.test", 60}});
+
+    const auto response = sfap::net::dns::decode_response(message, "ALIAS.Example.TEST.");
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response->id, 0xBEEF);
+    EXPECT_EQ(response->type, Type::A);
+    EXPECT_EQ(response->rcode, 0);
+    EXPECT_FALSE(response->truncated);
+    EXPECT_EQ(response->ttl, 60u);
+    ASSERT_EQ(response->answers().size(), 2u);
+    EXPECT_EQ(response->answers()[0], "192.0.2.1"_ip);
+    EXPECT_EQ(response->answers()[1], "192.0.2.2"_ip);
+
+    EXPECT_FALSE(sfap::net::dns::decode_response(message, "other.example.test"));
+}
+
+TEST(Dns, DecodeResponseRejectsMalformedMessages) {
+    std::array<std::byte, 512> query;
+    const auto size = sfap::net::dns::encode_query(query, 7, "a.test", Type::A);
+    ASSERT_TRUE(size);
+    const std::span<const std::byte> q{query.data(), *size};
+
+    // A query is not a response.
+    EXPECT_FALSE(sfap::net::dns::decode_response(q, "a.test"));
+    EXPECT_FALSE(sfap::net::dns::decode_response(q.first(11), "a.test"));
+
+    auto good = respond(q, 0, {{1, ip_rdata("192.0.2.1"_ip)}});
+    EXPECT_TRUE(sfap::net::dns::decode_response(good, "a.test"));
+
+    // Answer cut short.
+    EXPECT_FALSE(sfap::net::dns::decode_response(std::span{good}.first(good.size() - 2), "a.test"));
+
+    // Answer owner pointing at itself.
+    auto loop = good;
+    loop[q.size()] = std::byte{0xC0};
+    loop[q.size() + 1] = static_cast<std::byte>(q.size());
+    EXPECT_FALSE(sfap::net::dns::decode_response(loop, "a.test"));
+
+    // Forward pointer.
+    auto forward = good;
+    forward[q.size() + 1] = static_cast<std::byte>(q.size() + 4);
+    EXPECT_FALSE(sfap::net::dns::decode_response(forward, "a.test"));
+
+    // A truncated response keeps the complete records.
+    auto truncated = respond(q, 0x0200, {{1, ip_rdata("192.0.2.1"_ip)}, {1, ip_rdata("192.0.2.2"_ip)}});
+    truncated.resize(truncated.size() - 3);
+    const auto partial = sfap::net::dns::decode_response(truncated, "a.test");
+    ASSERT_TRUE(partial);
+    EXPECT_TRUE(partial->truncated);
+    EXPECT_EQ(partial->answers().size(), 1u);
+}
+
+TEST(Dns, ParseResolvConf) {
+    Config config;
+    config.parse_resolv_conf("# comment\n"
+                             "nameserver 192.0.2.53\n"
+                             "nameserver 2001:db8::53 ; trailing comment\n"
+                             "nameserver not-an-ip\n"
+                             "domain ignored.test\n"
+                             "search corp.test. example.test\n"
+                             "options ndots:2 timeout:3 attempts:4 rotate\n"
+                             "nameserver 192.0.2.54\n"
+                             "nameserver 192.0.2.55\n");
+
+    ASSERT_EQ(config.servers().size(), 3u);
+    EXPECT_EQ(config.servers()[0], Address("192.0.2.53"_ip, 53));
+    EXPECT_EQ(config.servers()[1], Address("2001:db8::53"_ip, 53));
+    EXPECT_EQ(config.servers()[2], Address("192.0.2.54"_ip, 53));
+    EXPECT_EQ(names(config.domains()), (std::vector<std::string>{"corp.test", "example.test"}));
+    EXPECT_EQ(config.ndots, 2u);
+    EXPECT_EQ(config.timeout, 3s);
+    EXPECT_EQ(config.attempts, 4u);
+
+    Config empty;
+    empty.parse_resolv_conf("");
+    ASSERT_EQ(empty.servers().size(), 1u);
+    EXPECT_EQ(empty.servers()[0], Address("127.0.0.1"_ip, 53));
+}
+
+TEST(Dns, CandidatesFollowNdots) {
+    Config config;
+    ASSERT_TRUE(config.add_search("corp.test"));
+    ASSERT_TRUE(config.add_search("example.test."));
+
+    EXPECT_EQ(names(config.candidates("host")),
+              (std::vector<std::string>{"host.corp.test", "host.example.test", "host"}));
+    EXPECT_EQ(names(config.candidates("www.site")),
+              (std::vector<std::string>{"www.site", "www.site.corp.test", "www.site.example.test"}));
+    EXPECT_EQ(names(config.candidates("host.")), (std::vector<std::string>{"host"}));
+
+    config.ndots = 2;
+    EXPECT_EQ(names(config.candidates("www.site")).back(), "www.site");
+}
+
+TEST(Dns, CandidatesStayWithinLimits) {
+    Config config;
+    for (std::size_t i = 0; i < Config::max_search; ++i)
+        ASSERT_TRUE(config.add_search("d" + std::to_string(i) + ".test"));
+    EXPECT_FALSE(config.add_search("one-too-many.test"));
+    EXPECT_FALSE(Config{}.add_search(std::string(sfap::net::dns::max_name_size + 1, 'x')));
+    EXPECT_EQ(names(config.candidates("host")).size(), Config::max_search + 1);
+
+    // Joined names longer than a domain name may be are skipped, the bare name is still tried.
+    const std::string label(sfap::net::dns::max_name_size - 4, 'x');
+    EXPECT_EQ(names(config.candidates(label)), (std::vector<std::string>{label}));
+
+    Config servers;
+    for (std::size_t i = 0; i < Config::max_nameservers; ++i)
+        ASSERT_TRUE(servers.add_nameserver(Address{"192.0.2.53"_ip, 53}));
+    EXPECT_FALSE(servers.add_nameserver(Address{"192.0.2.54"_ip, 53}));
+}
+
+TEST(Dns, HostsFile) {
+    Hosts hosts;
+    const auto error = hosts.parse("127.0.0.1 localhost\n"
+                                   "::1 localhost ip6-localhost # loopback\n"
+                                   "192.0.2.1\tGateway gw.corp.test\n"
+                                   "192.0.2.2 gateway\n"
+                                   "fe80::1%eth0 scoped\n"
+                                   "garbage line\n");
+    EXPECT_FALSE(error);
+
+    EXPECT_EQ(hosts.size(), 4u);
+    EXPECT_EQ(hosts.find("gw.corp.test", ResolveMode::PREFER_IPV4), "192.0.2.1"_ip);
+    EXPECT_EQ(hosts.find("localhost", ResolveMode::PREFER_IPV4), "127.0.0.1"_ip);
+    EXPECT_EQ(hosts.find("localhost", ResolveMode::PREFER_IPV6), "::1"_ip);
+    EXPECT_EQ(hosts.find("LOCALHOST.", ResolveMode::REQUIRE_IPV6), "::1"_ip);
+    EXPECT_EQ(hosts.find("gateway", ResolveMode::PREFER_IPV6), "192.0.2.1"_ip);
+    EXPECT_EQ(hosts.find("ip6-localhost", ResolveMode::REQUIRE_IPV4), std::nullopt);
+    EXPECT_EQ(hosts.find("scoped", ResolveMode::PREFER_IPV4), std::nullopt);
+    EXPECT_EQ(hosts.find("nowhere", ResolveMode::PREFER_IPV4), std::nullopt);
+}
+
+TEST(Dns, HostsTableGrows) {
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "192.0.2." + std::to_string(i) + " host" + std::to_string(i) + " alias" + std::to_string(i) + "\n";
+
+    Hosts hosts;
+    EXPECT_FALSE(hosts.parse(text));
+    EXPECT_EQ(hosts.size(), 200u);
+    for (int i = 0; i < 100; ++i) {
+        const ipx_t ip{sfap::net::ip4_t{192, 0, 2, static_cast<std::uint8_t>(i)}};
+        EXPECT_EQ(hosts.find("HOST" + std::to_string(i), ResolveMode::PREFER_IPV4), ip);
+        EXPECT_EQ(hosts.find("alias" + std::to_string(i) + ".", ResolveMode::REQUIRE_IPV4), ip);
+    }
+
+    Hosts moved{std::move(hosts)};
+    EXPECT_EQ(moved.size(), 200u);
+    EXPECT_EQ(moved.find("host7", ResolveMode::PREFER_IPV4), "192.0.2.7"_ip);
+}
+
+TEST(DnsResolve, LiteralsAndHostsNeedNoQueries) {
+    StubServer server;
+    BlockingProactor proactor;
+    Config config{stub_config(server)};
+    config.hosts.parse("192.0.2.99 pinned.test\n");
+
+    EXPECT_EQ(resolve(proactor, "192.0.2.7", ResolveMode::PREFER_IPV4, config), "192.0.2.7"_ip);
+    EXPECT_FALSE(resolve(proactor, "192.0.2.7", ResolveMode::REQUIRE_IPV6, config));
+    EXPECT_EQ(resolve(proactor, "pinned.test", ResolveMode::PREFER_IPV6, config), "192.0.2.99"_ip);
+    EXPECT_FALSE(resolve(proactor, "bad..name", ResolveMode::PREFER_IPV4, config));
+    EXPECT_EQ(server.queries(), 0);
+}
+
+TEST(DnsResolve, QueriesServerByMode) {
+    StubServer server;
+    BlockingProactor proactor;
+    const Config config{stub_config(server)};
+
+    EXPECT_EQ(resolve(proactor, "www.example.test", ResolveMode::PREFER_IPV4, config), "192.0.2.10"_ip);
+    EXPECT_EQ(resolve(proactor, "www.example.test", ResolveMode::PREFER_IPV6, config), "2001:db8::10"_ip);
+    EXPECT_EQ(resolve(proactor, "www.example.test", ResolveMode::REQUIRE_IPV6, config), "2001:db8::10"_ip);
+    EXPECT_EQ(resolve(proactor, "alias.example.test", ResolveMode::REQUIRE_IPV4, config), "192.0.2.11"_ip);
+    EXPECT_EQ(resolve(proactor, "v4only.example.test", ResolveMode::PREFER_IPV6, config), "192.0.2.12"_ip);
+    EXPECT_EQ(resolve(proactor, "spoof.example.test", ResolveMode::REQUIRE_IPV4, config), "192.0.2.13"_ip);
+
+    const auto no_data = resolve(proactor, "v4only.example.test", ResolveMode::REQUIRE_IPV6, config);
+    ASSERT_FALSE(no_data);
+    EXPECT_EQ(no_data.error(), sfap::net::dns::error(sfap::net::dns::errc::NO_DATA).error());
+
+    const auto missing = resolve(proactor, "missing.example.test", ResolveMode::PREFER_IPV4, config);
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error(), sfap::net::dns::error(sfap::net::dns::errc::NAME_ERROR).error());
+}
+
+TEST(DnsResolve, ResolveAllReturnsBothFamiliesPreferredFirst) {
+    StubServer server;
+    BlockingProactor proactor;
+    const Config config{stub_config(server)};
+
+    const auto v6_first = resolve_all(proactor, "www.example.test", ResolveMode::PREFER_IPV6, config);
+    ASSERT_TRUE(v6_first);
+    ASSERT_EQ(v6_first->size(), 2u);
+    EXPECT_EQ((*v6_first)[0], "2001:db8::10"_ip);
+    EXPECT_EQ((*v6_first)[1], "192.0.2.10"_ip);
+
+    const auto v4_only = resolve_all(proactor, "www.example.test", ResolveMode::REQUIRE_IPV4, config);
+    ASSERT_TRUE(v4_only);
+    ASSERT_EQ(v4_only->size(), 1u);
+    EXPECT_EQ((*v4_only)[0], "192.0.2.10"_ip);
+
+    const auto partial = resolve_all(proactor, "v4only.example.test", ResolveMode::PREFER_IPV6, config);
+    ASSERT_TRUE(partial);
+    ASSERT_EQ(partial->size(), 1u);
+    EXPECT_EQ((*partial)[0], "192.0.2.12"_ip);
+}
+
+TEST(DnsResolve, SearchListAndTcpFallback) {
+    StubServer server;
+    BlockingProactor proactor;
+    Config config{stub_config(server)};
+    config.add_search("nowhere.test");
+    config.add_search("corp.test");
+
+    EXPECT_EQ(resolve(proactor, "host", ResolveMode::REQUIRE_IPV4, config), "192.0.2.10"_ip);
+
+    EXPECT_EQ(resolve(proactor, "big.example.test", ResolveMode::REQUIRE_IPV4, config), "198.51.100.1"_ip);
+    EXPECT_EQ(server.tcp_queries(), 1);
+}
+
+TEST(DnsResolve, TimesOutAndFailsOver) {
+    StubServer server;
+    BlockingProactor proactor;
+
+    // Bound but never read: queries to it go unanswered.
+    const int black_hole{::socket(AF_INET, SOCK_DGRAM, 0)};
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(black_hole, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    socklen_t len{sizeof(addr)};
+    ::getsockname(black_hole, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    Config config;
+    config.add_nameserver(Address{"127.0.0.1"_ip, ntohs(addr.sin_port)});
+    config.add_nameserver(server.address());
+    config.timeout = 100ms;
+    config.attempts = 1;
+
+    const auto start{std::chrono::steady_clock::now()};
+    EXPECT_EQ(resolve(proactor, "www.example.test", ResolveMode::PREFER_IPV4, config), "192.0.2.10"_ip);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 100ms);
+
+    config.attempts = 2;
+    const auto silent = resolve(proactor, "silent.example.test", ResolveMode::PREFER_IPV4, config);
+    ASSERT_FALSE(silent);
+    EXPECT_EQ(silent.error(), sfap::net::dns::error(sfap::net::dns::errc::TIMEOUT).error());
+
+    ::close(black_hole);
+}
@@ -0,0 +1,105 @@
+/*!
+  \file
+  \brief Loopback listening socket shared by the connect tests.
+
+  \copyright Copyright (c) 2025 Wiktor Sołtys
+
+  \note License text intentionally omitted from docs. See repository LICENSE.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <sfap/net/address.hpp>
+#include <sfap/net/types.hpp>
+
+namespace test {
+
+/// \brief Listening loopback socket; connects complete through the backlog without accept().
+class Listener {
+  public:
+    /*!
+      \param family `AF_INET` or `AF_INET6`. IPv6 listeners are IPv6-only.
+      \param port `0` for any free port.
+    */
+    explicit Listener(int family = AF_INET, std::uint16_t port = 0) : family_(family) {
+        fd_ = ::socket(family, SOCK_STREAM, 0);
+        const int on{1};
+        ::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+        int ok{};
+        if (family == AF_INET6) {
+            ::setsockopt(fd_, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof(on));
+            sockaddr_in6 address{};
+            address.sin6_family = AF_INET6;
+            address.sin6_addr = in6addr_loopback;
+            address.sin6_port = htons(port);
+            ok = ::bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        } else {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(port);
+            ok = ::bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        }
+        if (ok != 0 || ::listen(fd_, 64) != 0) {
+            close();
+            return;
+        }
+
+        sockaddr_storage bound{};
+        socklen_t size{sizeof(bound)};
+        ::getsockname(fd_, reinterpret_cast<sockaddr*>(&bound), &size);
+        port_ = ntohs(family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+                                         : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+    }
+
+    Listener(const Listener&) = delete;
+    Listener& operator=(const Listener&) = delete;
+
+    ~Listener() {
+        close();
+    }
+
+    void close() {
+        if (fd_ >= 0)
+            ::close(fd_);
+        fd_ = -1;
+    }
+
+    explicit operator bool() const {
+        return fd_ >= 0;
+    }
+
+    /// \return Server end of the oldest pending connection.
+    int accept() {
+        return ::accept(fd_, nullptr, nullptr);
+    }
+
+    std::uint16_t port() const {
+        return port_;
+    }
+
+    /// \return Loopback address and port the listener is bound to.
+    sfap::net::Address address() const {
+        if (family_ == AF_INET6) {
+            sfap::net::ip6_t loopback{};
+            loopback[15] = 1;
+            return sfap::net::Address{sfap::net::ipx_t(loopback), port_};
+        }
+        return sfap::net::Address{sfap::net::ipx_t(sfap::net::ip4_t{127, 0, 0, 1}), port_};
+    }
+
+  private:
+    int fd_{-1};
+    int family_{};
+    std::uint16_t port_{};
+};
+
+} // namespace test
@@ -0,0 +1,171 @@
+#include <array>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/net/address.hpp>
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/types.hpp>
+
+using namespace sfap::net::literals;
+
+using sfap::net::Address;
+using sfap::net::ip4_t;
+using sfap::net::ip6_t;
+using sfap::net::ipx_t;
+using sfap::net::parse_ip;
+using sfap::net::parse_ip4;
+using sfap::net::parse_ip6;
+
+namespace {
+
+/// \brief Checks both parsers against inet_pton for \p text.
+void expect_same_as_inet_pton(const std::string& text) {
+    in_addr v4{};
+    const bool is_v4{::inet_pton(AF_INET, text.c_str(), &v4) == 1};
+    const auto ip4 = parse_ip4(text);
+    ASSERT_EQ(ip4.has_value(), is_v4) << '"' << text << '"';
+    if (is_v4) {
+        EXPECT_EQ(std::memcmp(ip4->data(), &v4, sizeof(v4)), 0) << text;
+    }
+
+    in6_addr v6{};
+    const bool is_v6{::inet_pton(AF_INET6, text.c_str(), &v6) == 1};
+    const auto ip6 = parse_ip6(text);
+    ASSERT_EQ(ip6.has_value(), is_v6) << '"' << text << '"';
+    if (is_v6) {
+        EXPECT_EQ(std::memcmp(ip6->data(), &v6, sizeof(v6)), 0) << text;
+    }
+
+    const auto ip = parse_ip(text);
+    ASSERT_EQ(ip.has_value(), is_v4 || is_v6) << '"' << text << '"';
+    if (ip) {
+        EXPECT_EQ(ip->is_4(), is_v4) << text;
+    }
+}
+
+} // namespace
+
+TEST(ParseIp, Ip4Literals) {
+    EXPECT_EQ(parse_ip4("203.0.113.5"), (ip4_t{203, 0, 113, 5}));
+    EXPECT_EQ(parse_ip4("0.0.0.0"), (ip4_t{}));
+    EXPECT_EQ(parse_ip4("255.255.255.255"), (ip4_t{255, 255, 255, 255}));
+
+    for (const char* bad : {"", "1.2.3", "1.2.3.4.", "1.2.3.4.5", "256.1.1.1", "01.2.3.4", "1.2.3.004", "1..2.3",
+                            " 1.2.3.4", "1.2.3.4 ", "0x1.2.3.4", "127.1", "1.2.3.-4"})
+        EXPECT_FALSE(parse_ip4(bad)) << bad;
+}
+
+TEST(ParseIp, Ip6Literals) {
+    ip6_t loopback{};
+    loopback[15] = 1;
+    EXPECT_EQ(parse_ip6("::1"), loopback);
+    EXPECT_EQ(parse_ip6("::"), ip6_t{});
+    EXPECT_EQ(parse_ip6("0:0:0:0:0:0:0:1"), loopback);
+
+    const auto mapped = parse_ip6("::ffff:192.0.2.128");
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ((*mapped)[10], 0xFF);
+    EXPECT_EQ((*mapped)[11], 0xFF);
+    EXPECT_EQ((*mapped)[12], 192);
+    EXPECT_EQ((*mapped)[15], 128);
+
+    for (const char* bad : {":", ":::", "1:", ":1", "1:::2", "1::2::3", "12345::", "1:2:3:4:5:6:7:8:9",
+                            "1:2:3:4:5:6:7::8", "[::1]", "fe80::1%eth0", "::1.2.3", "1.2.3.4", "::ffff:1.2.3.4:1"})
+        EXPECT_FALSE(parse_ip6(bad)) << bad;
+}
+
+TEST(ParseIp, IgnoresTextAfterView) {
+    const std::string_view text{"10.0.0.1:8080"};
+    EXPECT_EQ(parse_ip4(text.substr(0, 8)), (ip4_t{10, 0, 0, 1}));
+    EXPECT_FALSE(parse_ip4(text));
+}
+
+TEST(ParseIp, MatchesInetPtonOnSamples) {
+    for (const char* text :
+         {"1.2.3.4", "10.0.0.255", "300.1.1.1", "1.2.3.04", "0.0.0.0", "2001:db8::1", "2001:DB8:0:0:8:800:200C:417A",
+          "ff02::1:ff00:0", "::ffff:0.0.0.0", "64:ff9b::192.0.2.33", "1:2:3:4:5:6:1.2.3.4", "1:2:3:4:5:6:7:1.2.3.4",
+          "::1:2:3:4:5:6:7", "1:2:3:4:5:6:7::", "1::", "::0:0", "abcd:", "a:b:c:d:e:f:0:1", "0000:0000::00000"})
+        expect_same_as_inet_pton(text);
+}
+
+TEST(ParseIp, MatchesInetPtonOnRandomInput) {
+    constexpr std::string_view alphabet{"0123456789abcdefABCDEFx:.:."};
+    std::mt19937 rng{0x5fa9};
+    std::uniform_int_distribution<std::size_t> pick{0, alphabet.size() - 1};
+    std::uniform_int_distribution<std::size_t> length{0, 46};
+
+    for (int round = 0; round < 200000; ++round) {
+        std::string text(length(rng), '\0');
+        for (auto& c : text)
+            c = alphabet[pick(rng)];
+        expect_same_as_inet_pton(text);
+        if (::testing::Test::HasFailure())
+            return;
+    }
+}
+
+TEST(ParseIp, MatchesInetPtonOnMutatedAddresses) {
+    constexpr std::string_view replacements{"0:.f9"};
+    std::mt19937 rng{0xd15c};
+    std::uniform_int_distribution<int> byte{0, 255};
+
+    for (int round = 0; round < 50000; ++round) {
+        std::array<unsigned char, 16> raw;
+        for (auto& b : raw)
+            b = static_cast<unsigned char>(byte(rng) < 96 ? 0 : byte(rng));
+
+        char text[INET6_ADDRSTRLEN];
+        const int family{round % 2 ? AF_INET6 : AF_INET};
+        ASSERT_NE(::inet_ntop(family, raw.data(), text, sizeof(text)), nullptr);
+
+        std::string mutated{text};
+        expect_same_as_inet_pton(mutated);
+        const std::size_t at{static_cast<std::size_t>(byte(rng)) % mutated.size()};
+        mutated[at] = replacements[static_cast<std::size_t>(byte(rng)) % replacements.size()];
+        expect_same_as_inet_pton(mutated);
+        if (::testing::Test::HasFailure())
+            return;
+    }
+}
+
+TEST(ParseIp, ResolveUsesLiteralsDirectly) {
+    using sfap::net::ResolveMode;
+
+    const auto v6 = sfap::net::resolve("2001:db8::7", ResolveMode::REQUIRE_IPV6);
+    ASSERT_TRUE(v6);
+    EXPECT_EQ(v6->get_6()[15], 7);
+
+    EXPECT_FALSE(sfap::net::resolve("2001:db8::7", ResolveMode::REQUIRE_IPV4));
+    EXPECT_FALSE(sfap::net::resolve("192.0.2.1", ResolveMode::REQUIRE_IPV6));
+    EXPECT_TRUE(sfap::net::resolve("192.0.2.1", ResolveMode::PREFER_IPV6)->is_4());
+}
+
+TEST(ParseIp, LiteralsAreConstantExpressions) {
+    static_assert("192.0.2.1"_ip4 == ip4_t{192, 0, 2, 1});
+    static_assert("::ffff:10.0.0.1"_ip6[10] == 0xFF && "::ffff:10.0.0.1"_ip6[15] == 1);
+    static_assert("2001:db8::1"_ip.is_6());
+    static_assert("0.0.0.0"_ip == ipx_t{});
+    static_assert(parse_ip4("1.2.3.04") == std::nullopt);
+    static_assert(!parse_ip6("1::2::3"));
+
+    static constexpr std::array<Address, 2> peers{
+        Address{"10.0.0.1"_ip, 443},
+        Address{"2001:db8::10"_ip, 443},
+    };
+    static_assert(peers[0].is_connectable() && peers[1].get_address()->ip_.is_6());
+    static_assert(!Address{"::"_ip, 80}.is_connectable());
+    static_assert(!Address{}.is_bindable());
+
+    EXPECT_EQ(peers[0].get_address()->ip_.get_4(), (ip4_t{10, 0, 0, 1}));
+    EXPECT_FALSE(peers[1].get_origin());
+}
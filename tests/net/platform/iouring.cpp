@@ -2,10 +2,14 @@
 
 #if defined(SUPPORTED_IOURING)
 
+#include <array>
 #include <chrono>
 #include <future>
+#include <string>
+#include <string_view>
 #include <thread>
 
+#include <cerrno>
 #include <cstring>
 
 #include <arpa/inet.h>
@@ -13,7 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <sfap/net/dns.hpp>
 #include <sfap/net/platform/iouring.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/ringbuffer.hpp>
 
 using sfap::net::IOUringProactor;
 using sfap::net::Socket;
@@ -60,6 +67,40 @@ TEST(IOUringProactor, SleepForCompletesAndReturnsNoError) {
     loop.join();
 }
 
+TEST(IOUringProactor, RingBufferWaiterResumedOnLoopThread) {
+    IOUringProactor proactor{256};
+    if (!proactor) {
+        GTEST_SKIP() << "io_uring not available: " << proactor.get_error().message();
+    }
+
+    sfap::RingBuffer ring{64};
+    std::thread loop([&] { proactor.run(); });
+    const auto loop_id = loop.get_id();
+
+    std::promise<void> done;
+    auto fut = done.get_future();
+    std::thread::id resumed_on{};
+
+    auto consumer = [&]() -> sfap::task<void> {
+        const std::size_t n = co_await ring.readable(3, &proactor);
+        EXPECT_GE(n, 3u);
+        resumed_on = std::this_thread::get_id();
+        done.set_value();
+    };
+
+    auto task = consumer();
+    task.start_detached();
+
+    for (int i = 0; i < 3; ++i)
+        EXPECT_TRUE(ring.put(std::byte{1}));
+
+    EXPECT_EQ(fut.wait_for(2s), std::future_status::ready);
+    EXPECT_EQ(resumed_on, loop_id);
+
+    proactor.stop();
+    loop.join();
+}
+
 TEST(IOUringProactor, LoopbackConnectSendRecvUsingSocket) {
     IOUringProactor proactor{256};
     if (!proactor) {
@@ -120,7 +161,8 @@ TEST(IOUringProactor, LoopbackConnectSendRecvUsingSocket) {
         std::array<std::byte, sizeof(msg)> send_buf{};
         std::memcpy(send_buf.data(), msg, sizeof(msg));
 
-        co_await sock.send_bytes(send_buf);
+        const auto sent = co_await sock.send_bytes(send_buf);
+        EXPECT_TRUE(sent && *sent == send_buf.size());
 
         std::array<std::byte, sizeof(msg)> recv_buf{};
         co_await sock.recv_bytes(recv_buf, true);
@@ -141,4 +183,167 @@ TEST(IOUringProactor, LoopbackConnectSendRecvUsingSocket) {
     server_thread.join();
 }
 
-#endif
\ No newline at end of file
+TEST(IOUringProactor, LoopbackSendChainInOneMessage) {
+    IOUringProactor proactor{256};
+    if (!proactor) {
+        GTEST_SKIP() << "io_uring not available: " << proactor.get_error().message();
+    }
+
+    std::promise<std::uint16_t> port_promise;
+    auto port_future = port_promise.get_future();
+    std::string received;
+
+    std::thread server_thread([&] {
+        int srv = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_GE(srv, 0) << "socket() failed";
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_EQ(::bind(srv, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0) << "bind() failed";
+        ASSERT_EQ(::listen(srv, 1), 0) << "listen() failed";
+
+        socklen_t len = sizeof(addr);
+        ASSERT_EQ(::getsockname(srv, reinterpret_cast<sockaddr*>(&addr), &len), 0) << "getsockname() failed";
+        port_promise.set_value(ntohs(addr.sin_port));
+
+        int client = ::accept(srv, nullptr, nullptr);
+        ASSERT_GE(client, 0) << "accept() failed";
+
+        std::array<char, 64> buf{};
+        while (received.size() < 16) {
+            const ssize_t n = ::recv(client, buf.data(), buf.size(), 0);
+            if (n <= 0)
+                break;
+            received.append(buf.data(), static_cast<std::size_t>(n));
+        }
+
+        ::close(client);
+        ::close(srv);
+    });
+
+    std::thread loop([&] { proactor.run(); });
+
+    std::promise<void> done;
+    auto done_future = done.get_future();
+
+    auto client_coro = [&]() -> sfap::task<void> {
+        auto conn_res = co_await proactor.connect(sfap::net::Address{"127.0.0.1", port_future.get()});
+        EXPECT_TRUE(conn_res) << "connect failed: " << conn_res.error().message();
+        Socket sock = std::move(*conn_res);
+
+        sfap::BufferChain chain;
+        for (std::string_view part : {"HDR|", "meta;", "payload"}) {
+            sfap::Buffer b{part.size()};
+            b.assign({reinterpret_cast<const std::byte*>(part.data()), part.size()});
+            chain.append(std::move(b));
+        }
+
+        const auto sent = co_await sock.send_bytes(std::move(chain));
+        EXPECT_TRUE(sent && *sent == 16u);
+
+        done.set_value();
+        co_return;
+    };
+
+    auto task = client_coro();
+    task.start_detached();
+
+    done_future.wait();
+    server_thread.join();
+
+    EXPECT_EQ(received, "HDR|meta;payload");
+
+    proactor.stop();
+    loop.join();
+}
+
+TEST(IOUringProactor, DatagramReceiveTimesOut) {
+    IOUringProactor proactor{256};
+    if (!proactor) {
+        GTEST_SKIP() << "io_uring not available: " << proactor.get_error().message();
+    }
+
+    // Bound but silent peer.
+    const int peer = ::socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(peer, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    socklen_t len = sizeof(addr);
+    ASSERT_EQ(::getsockname(peer, reinterpret_cast<sockaddr*>(&addr), &len), 0);
+
+    std::thread loop([&] { proactor.run(); });
+
+    std::promise<void> done;
+    auto done_future = done.get_future();
+
+    auto client_coro = [&]() -> sfap::task<void> {
+        auto socket = proactor.connect_datagram(sfap::net::Address{"127.0.0.1", ntohs(addr.sin_port)});
+        EXPECT_TRUE(socket);
+
+        std::array<std::byte, 16> buffer{};
+        const auto start = std::chrono::steady_clock::now();
+        const auto received = co_await proactor.socket_recv_for(socket->get_handle(), buffer, 50ms);
+        EXPECT_FALSE(received);
+        EXPECT_EQ(received.error(), sfap::network_error(ETIMEDOUT).error());
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+
+        // Literals resolve without any traffic.
+        EXPECT_EQ(co_await proactor.resolve("192.0.2.1"), sfap::net::ipx_t(sfap::net::ip4_t{192, 0, 2, 1}));
+
+        done.set_value();
+    };
+
+    auto task = client_coro();
+    task.start_detached();
+
+    EXPECT_EQ(done_future.wait_for(2s), std::future_status::ready);
+
+    proactor.stop();
+    loop.join();
+    ::close(peer);
+}
+
+TEST(IOUringProactor, ConnectAnyFallsBackAcrossFamilies) {
+    IOUringProactor proactor{256};
+    if (!proactor) {
+        GTEST_SKIP() << "io_uring not available: " << proactor.get_error().message();
+    }
+
+    const int srv = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(srv, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(srv, 4), 0);
+    socklen_t len = sizeof(addr);
+    ASSERT_EQ(::getsockname(srv, reinterpret_cast<sockaddr*>(&addr), &len), 0);
+
+    // Only IPv4 listens, so the preferred IPv6 attempt is refused first.
+    sfap::net::dns::Config config;
+    config.hosts.parse("127.0.0.1 dual.test\n::1 dual.test\n");
+
+    std::thread loop([&] { proactor.run(); });
+
+    std::promise<void> done;
+    auto done_future = done.get_future();
+
+    auto client_coro = [&]() -> sfap::task<void> {
+        auto socket = co_await proactor.connect_any("dual.test", ntohs(addr.sin_port),
+                                                    sfap::net::ResolveMode::PREFER_IPV6, 1s, config);
+        EXPECT_TRUE(socket) << "connect_any failed: " << socket.error().message();
+        done.set_value();
+    };
+
+    auto task = client_coro();
+    task.start_detached();
+
+    EXPECT_EQ(done_future.wait_for(2s), std::future_status::ready);
+
+    proactor.stop();
+    loop.join();
+    ::close(srv);
+}
+
+#endif
@@ -0,0 +1,215 @@
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <sfap/net/parse_ip.hpp>
+#include <sfap/net/prefix_table.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/memory.hpp>
+
+using namespace sfap::net::literals;
+
+using sfap::net::ip4_t;
+using sfap::net::ip6_t;
+using sfap::net::ipx_t;
+using sfap::net::PrefixTable;
+
+namespace {
+
+struct Reference {
+    ipx_t address;
+    std::uint8_t length;
+    std::uint32_t value;
+};
+
+bool covers(const Reference& prefix, const ipx_t& address) {
+    if (prefix.address.is_4() != address.is_4())
+        return false;
+    for (std::size_t bit = 0; bit < prefix.length; ++bit) {
+        const auto mask{static_cast<std::uint8_t>(0x80u >> (bit % 8))};
+        if ((prefix.address.data()[bit / 8] & mask) != (address.data()[bit / 8] & mask))
+            return false;
+    }
+    return true;
+}
+
+/// \brief Longest covering prefix, last added winning among equals.
+std::optional<std::uint32_t> brute_force(const std::vector<Reference>& prefixes, const ipx_t& address) {
+    std::optional<std::uint32_t> best;
+    int best_length{-1};
+    for (const auto& prefix : prefixes) {
+        if (covers(prefix, address) && prefix.length >= best_length) {
+            best = prefix.value;
+            best_length = prefix.length;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+TEST(PrefixTable, EmptyTableMatchesNothing) {
+    const PrefixTable table;
+    EXPECT_FALSE(table.lookup("10.0.0.1"_ip));
+    EXPECT_EQ(table.size(), 0u);
+
+    auto built = PrefixTable::Builder{}.build();
+    ASSERT_TRUE(built);
+    EXPECT_FALSE(built->contains("::1"_ip));
+}
+
+TEST(PrefixTable, LongestPrefixWins) {
+    PrefixTable::Builder builder;
+    ASSERT_TRUE(builder.add("10.0.0.0/8", 1));
+    ASSERT_TRUE(builder.add("10.1.0.0/16", 2));
+    ASSERT_TRUE(builder.add("10.1.2.0/23", 3));
+    ASSERT_TRUE(builder.add("10.1.2.3", 4));
+    ASSERT_TRUE(builder.add("2001:db8::/32", 6));
+    ASSERT_TRUE(builder.add("2001:db8:1::/48", 7));
+
+    auto table = builder.build();
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->size(), 6u);
+
+    EXPECT_EQ(table->lookup("10.200.0.1"_ip), 1u);
+    EXPECT_EQ(table->lookup("10.1.200.1"_ip), 2u);
+    EXPECT_EQ(table->lookup("10.1.3.255"_ip), 3u);
+    EXPECT_EQ(table->lookup("10.1.2.3"_ip), 4u);
+    EXPECT_EQ(table->lookup("10.1.4.0"_ip), 2u);
+    EXPECT_FALSE(table->lookup("11.0.0.0"_ip));
+
+    EXPECT_EQ(table->lookup("2001:db8:ffff::1"_ip), 6u);
+    EXPECT_EQ(table->lookup("2001:db8:1:2::1"_ip), 7u);
+    EXPECT_FALSE(table->lookup("2001:db9::1"_ip));
+
+    // IPv4 and its mapped IPv6 form are different keys.
+    EXPECT_FALSE(table->lookup("::ffff:10.1.2.3"_ip));
+}
+
+TEST(PrefixTable, DefaultRoutesAndDuplicates) {
+    PrefixTable::Builder builder;
+    ASSERT_TRUE(builder.add("0.0.0.0/0", 1));
+    ASSERT_TRUE(builder.add("::/0", 2));
+    ASSERT_TRUE(builder.add("192.0.2.77/24", 3));
+    ASSERT_TRUE(builder.add("192.0.2.0/24", 4));
+
+    auto table = builder.build();
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->size(), 3u);
+    EXPECT_EQ(table->lookup("8.8.8.8"_ip), 1u);
+    EXPECT_EQ(table->lookup("fe80::1"_ip), 2u);
+    EXPECT_EQ(table->lookup("192.0.2.1"_ip), 4u);
+}
+
+TEST(PrefixTable, RejectsInvalidPrefixes) {
+    PrefixTable::Builder builder;
+    EXPECT_FALSE(builder.add("10.0.0.0/33", 1));
+    EXPECT_FALSE(builder.add("10.0.0.0/", 1));
+    EXPECT_FALSE(builder.add("10.0.0/8", 1));
+    EXPECT_FALSE(builder.add("::/129", 1));
+    EXPECT_FALSE(builder.add("::/0128", 1));
+    EXPECT_FALSE(builder.add("10.0.0.0/8", PrefixTable::max_value + 1));
+    EXPECT_FALSE(builder.add("10.0.0.0"_ip, 33, 1));
+    EXPECT_TRUE(builder.add("::/128", PrefixTable::max_value));
+    EXPECT_EQ(builder.size(), 1u);
+}
+
+TEST(PrefixTable, ParsesText) {
+    PrefixTable::Builder builder;
+    const auto added = builder.add_text("# deny list\n"
+                                        "198.51.100.0/24\n"
+                                        "\n"
+                                        "  203.0.113.0/25   9  # scanners\n"
+                                        "2001:db8::/32\t5\r\n",
+                                        1);
+    ASSERT_TRUE(added);
+    EXPECT_EQ(*added, 3u);
+
+    auto table = builder.build();
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->lookup("198.51.100.7"_ip), 1u);
+    EXPECT_EQ(table->lookup("203.0.113.100"_ip), 9u);
+    EXPECT_FALSE(table->lookup("203.0.113.200"_ip));
+    EXPECT_EQ(table->lookup("2001:db8::1"_ip), 5u);
+
+    EXPECT_FALSE(builder.add_text("10.0.0.0/8\nnot-a-prefix\n"));
+    EXPECT_FALSE(builder.add_text("10.0.0.0/8 x\n"));
+    EXPECT_EQ(builder.size(), 4u);
+}
+
+TEST(PrefixTable, MatchesBruteForce) {
+    std::mt19937 rng{0xAC1};
+    std::uniform_int_distribution<int> byte{0, 255};
+    std::uniform_int_distribution<int> length4{0, 32};
+    std::uniform_int_distribution<int> length6{0, 128};
+
+    // A few common high bytes keep prefixes overlapping.
+    const auto random_ip = [&](bool v4) {
+        ip6_t bytes{};
+        for (auto& b : bytes)
+            b = static_cast<std::uint8_t>(byte(rng));
+        bytes[0] = static_cast<std::uint8_t>(10 + byte(rng) % 3);
+        bytes[1] = static_cast<std::uint8_t>(byte(rng) % 4);
+        return v4 ? ipx_t{ip4_t{bytes[0], bytes[1], bytes[2], bytes[3]}} : ipx_t{bytes};
+    };
+
+    PrefixTable::Builder builder;
+    std::vector<Reference> reference;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        const bool v4{i % 3 != 0};
+        const Reference prefix{random_ip(v4), static_cast<std::uint8_t>(v4 ? length4(rng) / 2 + 12 : length6(rng)),
+                               i};
+        ASSERT_TRUE(builder.add(prefix.address, prefix.length, prefix.value));
+        reference.push_back(prefix);
+    }
+
+    auto table = builder.build(sfap::MemoryOptions{.pages = sfap::MemoryOptions::Pages::TRANSPARENT_HUGE});
+    ASSERT_TRUE(table);
+    EXPECT_GT(table->memory_usage(), 0u);
+
+    for (int i = 0; i < 4000; ++i) {
+        const ipx_t probe{random_ip(i % 2 == 0)};
+        ASSERT_EQ(table->lookup(probe), brute_force(reference, probe)) << i;
+    }
+    for (const auto& prefix : reference)
+        ASSERT_EQ(table->lookup(prefix.address), brute_force(reference, prefix.address));
+}
+
+TEST(PrefixTable, ConcurrentReadersWhileSwapping) {
+    const auto make = [](std::uint32_t value) {
+        PrefixTable::Builder builder;
+        builder.add("10.0.0.0/8", value);
+        return std::make_shared<const PrefixTable>(std::move(*builder.build()));
+    };
+
+    std::atomic<std::shared_ptr<const PrefixTable>> current{make(1)};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> mismatch{false};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                const auto table = current.load();
+                const auto value = table->lookup("10.1.2.3"_ip);
+                if (!value || (*value != 1 && *value != 2))
+                    mismatch = true;
+            }
+        });
+    }
+
+    for (int i = 0; i < 200; ++i)
+        current.store(make(1 + i % 2));
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_FALSE(mismatch);
+}
@@ -1,3 +1,7 @@
+#include <vector>
+
+#include <cstddef>
+
 #if defined(_WIN32)
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -8,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <sfap/net/resolve.hpp>
+#include <sfap/net/resolve_cache.hpp>
 #include <sfap/net/types.hpp>
 #include <sfap/utils/string.hpp>
 
@@ -40,6 +45,27 @@ TEST(ResolveIntegrationTest, RequireIPv6OnLoopbackV6) {
     EXPECT_TRUE(res->is_6());
 }
 
+TEST(ResolveIntegrationTest, RequireIPv6OfIPv4LiteralFailsLikeGetaddrinfo) {
+    addrinfo hints{};
+    hints.ai_family = AF_INET6;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* info = nullptr;
+    const int expected{::getaddrinfo("127.0.0.1", nullptr, &hints, &info)};
+    if (expected == 0) {
+        ::freeaddrinfo(info);
+        GTEST_SKIP() << "getaddrinfo maps IPv4 literals to IPv6 here";
+    }
+
+    for (const auto& res : {resolve("127.0.0.1", ResolveMode::REQUIRE_IPV6),
+                            sfap::net::resolve_uncached("127.0.0.1", ResolveMode::REQUIRE_IPV6)}) {
+        ASSERT_FALSE(res.has_value());
+        EXPECT_EQ(res.error(), sfap::net::resolve_error(expected).error());
+        EXPECT_TRUE(sfap::net::is_negative_answer(res.error()));
+    }
+    EXPECT_EQ(sfap::net::resolve_all("127.0.0.1", ResolveMode::REQUIRE_IPV6).error(),
+              sfap::net::resolve_error(expected).error());
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
 
@@ -59,4 +85,73 @@ int main(int argc, char** argv) {
 #endif
 
     return result;
-}
\ No newline at end of file
+}
+TEST(ResolveAllTest, LiteralGivesOneAddress) {
+    auto res = sfap::net::resolve_all("192.0.2.1", ResolveMode::PREFER_IPV6);
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res->size(), 1u);
+    EXPECT_EQ((*res)[0], sfap::net::ipx_t(sfap::net::ip4_t{192, 0, 2, 1}));
+
+    EXPECT_FALSE(sfap::net::resolve_all("192.0.2.1", ResolveMode::REQUIRE_IPV6));
+}
+
+TEST(ResolveAllTest, LocalhostListsPreferredFamilyFirst) {
+    auto v4 = sfap::net::resolve_all("localhost", ResolveMode::PREFER_IPV4);
+    ASSERT_TRUE(v4.has_value());
+    ASSERT_FALSE(v4->empty());
+
+    bool seen_6{false};
+    for (const auto& ip : *v4) {
+        seen_6 = seen_6 || ip.is_6();
+        EXPECT_FALSE(seen_6 && ip.is_4()) << "IPv4 address after an IPv6 one";
+    }
+
+    auto only_4 = sfap::net::resolve_all("localhost", ResolveMode::REQUIRE_IPV4);
+    if (only_4) {
+        for (const auto& ip : *only_4)
+            EXPECT_TRUE(ip.is_4());
+    }
+}
+
+TEST(ResolveAllTest, UnknownNameFails) {
+    EXPECT_FALSE(sfap::net::resolve_all(static_cast<const char*>(nullptr)));
+    EXPECT_FALSE(sfap::net::resolve_all("nonexistent.invalid"));
+}
+
+TEST(ResolveBatchTest, ResultsFollowInputOrder) {
+    const std::vector<sfap::String> names{sfap::String{"192.0.2.1"}, sfap::String{"nonexistent.invalid"},
+                                          sfap::String{"2001:db8::1"}, sfap::String{"192.0.2.1"}};
+
+    for (const std::size_t parallelism : {0u, 1u, 4u}) {
+        std::vector<sfap::result<sfap::net::ipx_t>> results(names.size());
+        ASSERT_FALSE(sfap::net::resolve_batch(names, results, ResolveMode::PREFER_IPV4, parallelism));
+        EXPECT_EQ(results[0], sfap::net::ipx_t(sfap::net::ip4_t{192, 0, 2, 1}));
+        EXPECT_FALSE(results[1]);
+        ASSERT_TRUE(results[2]);
+        EXPECT_TRUE(results[2]->is_6());
+        EXPECT_EQ(results[3], results[0]);
+    }
+
+    EXPECT_FALSE(sfap::net::resolve_batch({}, {}, ResolveMode::PREFER_IPV4));
+
+    std::vector<sfap::result<sfap::net::ipx_t>> short_results(names.size() - 1);
+    EXPECT_EQ(sfap::net::resolve_batch(names, short_results).code(),
+              static_cast<int>(sfap::errc::INVALID_ARGUMENT));
+}
+
+TEST(ResolveBatchTest, DuplicatesAreResolvedOnce) {
+    auto& cache = sfap::net::ResolveCache::global();
+    cache.clear();
+    const auto before = cache.stats();
+
+    const std::vector<sfap::String> names(64, sfap::String{"localhost"});
+    std::vector<sfap::result<sfap::net::ipx_t>> results(names.size());
+    ASSERT_FALSE(sfap::net::resolve_batch(names, results, ResolveMode::PREFER_IPV4, 8));
+
+    for (const auto& result : results)
+        EXPECT_EQ(result, results[0]);
+
+    const auto after = cache.stats();
+    EXPECT_EQ(after.misses - before.misses, 1u);
+    EXPECT_EQ(after.hits - before.hits, 0u);
+}
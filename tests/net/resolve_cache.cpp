@@ -0,0 +1,199 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstring>
+
+#include <netdb.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/resolve.hpp>
+#include <sfap/net/resolve_cache.hpp>
+#include <sfap/net/types.hpp>
+
+using namespace std::chrono_literals;
+
+using sfap::net::ip4_t;
+using sfap::net::ipx_t;
+using sfap::net::ResolveCache;
+using sfap::net::ResolveCacheOptions;
+using sfap::net::ResolveMode;
+
+namespace {
+
+std::atomic<int> calls{0};
+std::atomic<bool> failing{false};
+
+/// \brief Answers 10.0.0.N where N counts calls; names starting with "bad" do not exist, "flaky" ones time out.
+sfap::result<ipx_t> counting_resolver(const char* hostname, ResolveMode) noexcept {
+    const int n{++calls};
+    if (failing || std::strncmp(hostname, "bad", 3) == 0)
+        return sfap::net::resolve_error(EAI_NONAME);
+    if (std::strncmp(hostname, "flaky", 5) == 0)
+        return sfap::net::resolve_error(EAI_AGAIN);
+    return ipx_t{ip4_t{10, 0, 0, static_cast<std::uint8_t>(n)}};
+}
+
+ResolveCacheOptions options(std::chrono::milliseconds positive, std::chrono::milliseconds negative) {
+    calls = 0;
+    failing = false;
+    return {.positive_ttl = positive, .negative_ttl = negative, .refresh_ahead = 0, .resolver = &counting_resolver};
+}
+
+} // namespace
+
+TEST(ResolveCache, HitsAvoidTheResolver) {
+    ResolveCache cache{options(60s, 60s)};
+
+    const auto first = cache.resolve("peer.example", ResolveMode::PREFER_IPV4);
+    ASSERT_TRUE(first);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(cache.resolve("peer.example", ResolveMode::PREFER_IPV4), first);
+    EXPECT_EQ(calls, 1);
+
+    // Mode is part of the key.
+    EXPECT_NE(cache.resolve("peer.example", ResolveMode::REQUIRE_IPV4), first);
+    EXPECT_EQ(calls, 2);
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 10u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.size, 2u);
+
+    cache.clear();
+    EXPECT_EQ(cache.stats().size, 0u);
+    EXPECT_TRUE(cache.resolve("peer.example", ResolveMode::PREFER_IPV4));
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(ResolveCache, NegativeAndPositiveEntriesExpire) {
+    ResolveCache cache{options(60ms, 30ms)};
+
+    EXPECT_FALSE(cache.resolve("bad.example", ResolveMode::PREFER_IPV4));
+    EXPECT_FALSE(cache.resolve("bad.example", ResolveMode::PREFER_IPV4));
+    EXPECT_EQ(cache.stats().negative_hits, 1u);
+    EXPECT_TRUE(cache.resolve("good.example", ResolveMode::PREFER_IPV4));
+    EXPECT_EQ(calls, 2);
+
+    std::this_thread::sleep_for(40ms);
+    EXPECT_FALSE(cache.resolve("bad.example", ResolveMode::PREFER_IPV4));
+    EXPECT_TRUE(cache.resolve("good.example", ResolveMode::PREFER_IPV4));
+    EXPECT_EQ(calls, 3);
+
+    std::this_thread::sleep_for(40ms);
+    EXPECT_TRUE(cache.resolve("good.example", ResolveMode::PREFER_IPV4));
+    EXPECT_EQ(calls, 4);
+}
+
+TEST(ResolveCache, TransientFailuresAreNotCached) {
+    ResolveCache cache{options(60s, 60s)};
+
+    for (int i = 0; i < 3; ++i) {
+        const auto answer = cache.resolve("flaky.example", ResolveMode::PREFER_IPV4);
+        ASSERT_FALSE(answer);
+        EXPECT_EQ(answer.error().code(), EAI_AGAIN);
+    }
+    EXPECT_EQ(calls, 3);
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.negative_hits, 0u);
+    EXPECT_EQ(stats.size, 0u);
+}
+
+TEST(ResolveCache, RefreshesHotEntriesAhead) {
+    auto opts = options(200ms, 200ms);
+    opts.refresh_ahead = 0.75;
+    opts.refresh_min_hits = 2;
+    ResolveCache cache{opts};
+
+    const auto first = cache.resolve("hot.example", ResolveMode::PREFER_IPV4);
+    ASSERT_TRUE(first);
+    std::this_thread::sleep_for(80ms);
+
+    // One hit is not hot yet, the second is and triggers the refresh.
+    EXPECT_EQ(cache.resolve("hot.example", ResolveMode::PREFER_IPV4), first);
+    const auto refreshed = cache.resolve("hot.example", ResolveMode::PREFER_IPV4);
+    ASSERT_TRUE(refreshed);
+    EXPECT_NE(refreshed, first);
+    EXPECT_EQ(cache.stats().refreshes, 1u);
+    EXPECT_EQ(calls, 2);
+
+    // A failed refresh keeps serving the previous answer.
+    std::this_thread::sleep_for(80ms);
+    failing = true;
+    cache.resolve("hot.example", ResolveMode::PREFER_IPV4);
+    EXPECT_EQ(cache.resolve("hot.example", ResolveMode::PREFER_IPV4), refreshed);
+    EXPECT_EQ(cache.stats().refreshes, 2u);
+}
+
+TEST(ResolveCache, FailedRefreshBacksOff) {
+    auto opts = options(400ms, 400ms);
+    opts.refresh_ahead = 0.5;
+    opts.refresh_min_hits = 1;
+    ResolveCache cache{opts};
+
+    const auto first = cache.resolve("hot.example", ResolveMode::PREFER_IPV4);
+    ASSERT_TRUE(first);
+    std::this_thread::sleep_for(220ms);
+
+    // The refresh fails once; the next hits inside the window come from the cache.
+    failing = true;
+    EXPECT_EQ(cache.resolve("hot.example", ResolveMode::PREFER_IPV4), first);
+    EXPECT_EQ(calls, 2);
+    failing = false;
+
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(cache.resolve("hot.example", ResolveMode::PREFER_IPV4), first);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(cache.stats().refreshes, 1u);
+}
+
+TEST(ResolveCache, EvictsLeastRecentlyUsed) {
+    auto opts = options(60s, 60s);
+    opts.capacity = ResolveCache::shard_count * 2;
+    ResolveCache cache{opts};
+
+    for (int i = 0; i < 1000; ++i)
+        cache.resolve(("host" + std::to_string(i) + ".example").c_str(), ResolveMode::PREFER_IPV4);
+
+    const auto stats = cache.stats();
+    EXPECT_LE(stats.size, opts.capacity);
+    EXPECT_EQ(stats.evictions, 1000u - stats.size);
+
+    // The most recent name survives.
+    cache.resolve("host999.example", ResolveMode::PREFER_IPV4);
+    EXPECT_EQ(calls, 1000);
+}
+
+TEST(ResolveCache, ConcurrentLookupsShareEntries) {
+    ResolveCache cache{options(60s, 60s)};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 2000; ++i)
+                cache.resolve(("svc" + std::to_string(i % 50)).c_str(), ResolveMode::PREFER_IPV4);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.size, 50u);
+    EXPECT_EQ(stats.hits + stats.misses, 8000u);
+    EXPECT_LE(calls, 200);
+}
+
+TEST(ResolveCache, ResolveUsesGlobalCacheForNames) {
+    const auto before = ResolveCache::global().stats();
+    sfap::net::resolve("localhost", ResolveMode::PREFER_IPV4);
+    sfap::net::resolve("localhost", ResolveMode::PREFER_IPV4);
+    sfap::net::resolve("127.0.0.1", ResolveMode::PREFER_IPV4);
+    const auto after = ResolveCache::global().stats();
+
+    EXPECT_EQ(after.hits + after.negative_hits + after.misses - before.hits - before.negative_hits - before.misses, 2u);
+}
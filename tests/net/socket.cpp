@@ -0,0 +1,108 @@
+#include <array>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+#include <sfap/utils/task.hpp>
+
+#include "blocking_proactor.hpp"
+#include "listener.hpp"
+
+using sfap::BufferChain;
+using sfap::net::Socket;
+using test::BlockingProactor;
+using test::Listener;
+
+namespace {
+
+std::span<const std::byte> bytes(std::string_view text) {
+    return {reinterpret_cast<const std::byte*>(text.data()), text.size()};
+}
+
+BufferChain chain_of(std::string_view text) {
+    BufferChain chain;
+    sfap::Buffer buffer{text.size()};
+    buffer.assign(bytes(text));
+    chain.append(std::move(buffer));
+    return chain;
+}
+
+template <class Data> sfap::result<std::size_t> send(Socket& socket, Data data) {
+    sfap::result<std::size_t> out{sfap::generic_error(sfap::errc::INVALID_ARGUMENT)};
+    auto body = [&]() -> sfap::task<void> { out = co_await socket.send_bytes(std::move(data)); };
+    auto task = body();
+    task.start_detached();
+    return out;
+}
+
+Socket connect(BlockingProactor& proactor, const Listener& listener) {
+    Socket socket;
+    auto body = [&]() -> sfap::task<void> {
+        auto connected = co_await proactor.connect(listener.address(), BlockingProactor::duration::max(), {});
+        if (connected)
+            socket = std::move(*connected);
+    };
+    auto task = body();
+    task.start_detached();
+    return socket;
+}
+
+/// \brief Accept the pending connection and close it with a reset.
+void reset_peer(Listener& listener) {
+    const int fd{listener.accept()};
+    const linger abort{1, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_LINGER, &abort, sizeof(abort));
+    ::close(fd);
+}
+
+} // namespace
+
+TEST(Socket, SendBytesReportsBytesSent) {
+    Listener listener;
+    BlockingProactor proactor;
+    Socket socket = connect(proactor, listener);
+    ASSERT_TRUE(socket);
+
+    const auto sent = send(socket, bytes("Hello There."));
+    ASSERT_TRUE(sent);
+    EXPECT_EQ(*sent, 12u);
+
+    const auto chained = send(socket, chain_of("General Kenobi."));
+    ASSERT_TRUE(chained);
+    EXPECT_EQ(*chained, 15u);
+
+    const auto shared = send(socket, sfap::BufferSlice{sfap::SharedBuffer::copy_of(bytes("Kenobi."))});
+    ASSERT_TRUE(shared);
+    EXPECT_EQ(*shared, 7u);
+}
+
+TEST(Socket, SendBytesReportsClosedPeer) {
+    Listener listener;
+    BlockingProactor proactor;
+    Socket socket = connect(proactor, listener);
+    ASSERT_TRUE(socket);
+    reset_peer(listener);
+
+    EXPECT_FALSE(send(socket, bytes("lost")));
+    EXPECT_FALSE(send(socket, chain_of("lost")));
+    EXPECT_FALSE(send(socket, sfap::BufferSlice{sfap::SharedBuffer::copy_of(bytes("lost"))}));
+}
+
+TEST(Socket, SendBytesOnInvalidSocketFails) {
+    Socket socket;
+    const auto sent = send(socket, bytes("x"));
+    ASSERT_FALSE(sent);
+    EXPECT_EQ(sent.error(), sfap::generic_error(sfap::errc::INVALID_ARGUMENT).error());
+}
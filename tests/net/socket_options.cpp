@@ -0,0 +1,109 @@
+#include <chrono>
+
+#include <cerrno>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <sfap/error.hpp>
+#include <sfap/net/address.hpp>
+#include <sfap/net/socket.hpp>
+#include <sfap/net/socket_options.hpp>
+#include <sfap/net/types.hpp>
+#include <sfap/utils/task.hpp>
+
+#include "blocking_proactor.hpp"
+
+using sfap::net::SocketOptions;
+
+namespace {
+
+int get(int fd, int level, int name) {
+    int value{-1};
+    socklen_t size{sizeof(value)};
+    if (::getsockopt(fd, level, name, &value, &size) != 0)
+        return -1;
+    return value;
+}
+
+} // namespace
+
+TEST(SocketOptions, DefaultChangesNothing) {
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    const int send_buffer{get(fd, SOL_SOCKET, SO_SNDBUF)};
+
+    EXPECT_FALSE(sfap::net::apply_socket_options(fd, SocketOptions{}));
+    EXPECT_EQ(get(fd, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_EQ(get(fd, SOL_SOCKET, SO_SNDBUF), send_buffer);
+    ::close(fd);
+}
+
+TEST(SocketOptions, AppliesEverySetting) {
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+
+    const SocketOptions options{
+        .no_delay = true,
+        .send_buffer = 64 * 1024,
+        .receive_buffer = 128 * 1024,
+        .not_sent_lowat = 16 * 1024,
+    };
+    ASSERT_FALSE(sfap::net::apply_socket_options(fd, options));
+
+    EXPECT_NE(get(fd, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_GE(get(fd, SOL_SOCKET, SO_SNDBUF), options.send_buffer);
+    EXPECT_GE(get(fd, SOL_SOCKET, SO_RCVBUF), options.receive_buffer);
+    EXPECT_EQ(get(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT), options.not_sent_lowat);
+    ::close(fd);
+}
+
+TEST(SocketOptions, FastOpenConnect) {
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+
+    const auto error = sfap::net::apply_socket_options(fd, SocketOptions{.fast_open = true});
+    if (error && error.code() == ENOPROTOOPT) {
+        ::close(fd);
+        GTEST_SKIP() << "TCP_FASTOPEN_CONNECT unsupported";
+    }
+    ASSERT_FALSE(error) << error.message();
+    EXPECT_EQ(get(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT), 1);
+    ::close(fd);
+}
+
+TEST(SocketOptions, ReportsFailure) {
+    const auto error = sfap::net::apply_socket_options(-1, SocketOptions{.no_delay = true});
+    ASSERT_TRUE(error);
+    EXPECT_EQ(error.code(), EBADF);
+}
+
+TEST(SocketOptions, ConnectAppliesOptions) {
+    const int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    ASSERT_EQ(::listen(listener, 1), 0);
+    socklen_t size{sizeof(address)};
+    ASSERT_EQ(::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &size), 0);
+
+    test::BlockingProactor proactor;
+    sfap::result<sfap::net::Socket> socket{sfap::generic_error(sfap::errc::INVALID_ARGUMENT)};
+    auto body = [&]() -> sfap::task<void> {
+        socket = co_await proactor.connect(
+            sfap::net::Address{sfap::net::ipx_t(sfap::net::ip4_t{127, 0, 0, 1}), ntohs(address.sin_port)},
+            sfap::net::Proactor::duration::max(), SocketOptions{.no_delay = true});
+    };
+    auto task = body();
+    task.start_detached();
+
+    ASSERT_TRUE(socket);
+    EXPECT_NE(get(proactor.descriptor(socket->get_handle()), IPPROTO_TCP, TCP_NODELAY), 0);
+    ::close(listener);
+}
@@ -1,3 +1,5 @@
+#include <unordered_set>
+
 #include <gtest/gtest.h>
 
 #include <sfap/net/types.hpp>
@@ -46,3 +48,57 @@ TEST(IPX, DataPointerAndSizeMatchFamily) {
     const ipx_t ip6(ipv6);
     EXPECT_EQ(ip6.size(), 16u);
 }
+
+TEST(IPX, ConstexprQueriesAndEquality) {
+    constexpr ipx_t any4;
+    constexpr ipx_t any6{ip6_t{}};
+    constexpr ipx_t host{ip4_t{10, 0, 0, 1}};
+
+    static_assert(ipx_t::is_any(any4) && ipx_t::is_any(any6) && !ipx_t::is_any(host));
+    static_assert(host.family() == ipx_t::Family::V4 && host.size() == 4 && host.data()[3] == 1);
+    static_assert(any4 != any6);
+    static_assert(host == ipx_t{ip4_t{10, 0, 0, 1}});
+
+    EXPECT_EQ(host, ipx_t(ip4_t{10, 0, 0, 1}));
+    EXPECT_NE(host, any4);
+}
+
+TEST(IPX, CompactLayoutKeepsIPv4Mapped) {
+    static_assert(sizeof(ipx_t) == 17);
+
+    const ipx_t ip{ip4_t{192, 0, 2, 1}};
+    EXPECT_EQ(ip.as_6(), (ip6_t{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 192, 0, 2, 1}));
+    EXPECT_EQ(ip.data(), ip.as_6().data() + 12);
+    EXPECT_NE(ip, ipx_t{ip.as_6()});
+    EXPECT_FALSE(ipx_t::is_any(ipx_t{ip6_t{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 0, 0, 0, 0}}));
+}
+
+TEST(IPX, OrdersFamilyThenBytes) {
+    const ipx_t low{ip4_t{9, 255, 255, 255}};
+    const ipx_t high{ip4_t{10, 0, 0, 0}};
+    const ipx_t v6{ip6_t{}};
+
+    EXPECT_LT(low, high);
+    EXPECT_LT(high, v6);
+    EXPECT_EQ((low <=> ipx_t{ip4_t{9, 255, 255, 255}}), std::strong_ordering::equal);
+    static_assert(ipx_t{ip4_t{1, 2, 3, 4}} < ipx_t{ip4_t{1, 2, 3, 5}});
+}
+
+TEST(IPX, HashMatchesEqualityAndSpreads) {
+    static_assert(ipx_t{ip4_t{1, 2, 3, 4}}.hash() != ipx_t{ip4_t{1, 2, 3, 5}}.hash());
+
+    std::unordered_set<ipx_t> set;
+    std::unordered_set<std::size_t> hashes;
+    for (unsigned i = 0; i < 4096; ++i) {
+        const ipx_t ip{ip4_t{10, 0, static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i)}};
+        set.insert(ip);
+        hashes.insert(std::hash<ipx_t>{}(ip));
+        EXPECT_EQ(ip.hash(), ipx_t{ip.get_4()}.hash());
+    }
+    EXPECT_EQ(set.size(), 4096u);
+    EXPECT_EQ(hashes.size(), 4096u);
+
+    constexpr ipx_t folded{ip4_t{1, 2, 3, 4}};
+    const ipx_t runtime{ip4_t{1, 2, 3, 4}};
+    EXPECT_EQ(folded.hash(), runtime.hash());
+}
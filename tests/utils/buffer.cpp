@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <array>
 #include <optional>
+#include <random>
 #include <string>
+#include <vector>
 
 #include <cstring>
 
@@ -208,6 +210,69 @@ TEST(Buffer, PatternEdgeCases) {
     EXPECT_FALSE(b.find(std::span<const std::byte>{reinterpret_cast<const std::byte*>("abc"), 3}, 4).has_value());
 }
 
+TEST(Buffer, FindMatchesStdAlgorithmsOnRandomInput) {
+    std::mt19937 rng{12345};
+    // Small alphabet so first/last byte candidates are frequent and partial matches common.
+    std::uniform_int_distribution<int> symbol{'a', 'd'};
+
+    for (int round = 0; round < 2000; ++round) {
+        const std::size_t n = rng() % 300 + 1;
+        Buffer b{n};
+        ASSERT_TRUE(b.resize(n));
+        for (auto& x : b)
+            x = static_cast<std::byte>(symbol(rng));
+
+        const std::size_t from = rng() % n;
+        const auto c = static_cast<std::byte>(symbol(rng) + 1);
+        const auto expected_byte = std::find(b.begin() + from, b.end(), c);
+        const auto found_byte = b.find(c, from);
+        ASSERT_EQ(found_byte.has_value(), expected_byte != b.end());
+        if (found_byte) {
+            EXPECT_EQ(*found_byte, static_cast<std::size_t>(expected_byte - b.begin()));
+        }
+
+        const std::size_t m = std::min<std::size_t>(rng() % 40 + 1, n);
+        std::array<std::byte, 40> pattern{};
+        if (rng() % 2) {
+            const std::size_t at = rng() % (n - m + 1);
+            std::copy_n(b.begin() + at, m, pattern.begin());
+        } else {
+            for (std::size_t i = 0; i < m; ++i)
+                pattern[i] = static_cast<std::byte>(symbol(rng));
+        }
+
+        const std::span<const std::byte> needle{pattern.data(), m};
+        const auto found = b.find(needle, std::min(from, n - m));
+        const auto expected = std::search(b.begin() + std::min(from, n - m), b.end(), needle.begin(), needle.end());
+        ASSERT_EQ(found.has_value(), expected != b.end()) << "n=" << n << " m=" << m;
+        if (found) {
+            EXPECT_EQ(*found, static_cast<std::size_t>(expected - b.begin()));
+        }
+    }
+}
+
+TEST(Buffer, FindPatternAtVectorBoundaries) {
+    for (std::size_t n : {15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 4096u}) {
+        for (std::size_t m : {2u, 3u, 16u, 33u}) {
+            if (m > n)
+                continue;
+            Buffer b{n};
+            ASSERT_TRUE(b.resize(n));
+            std::fill(b.begin(), b.end(), std::byte{'x'});
+            std::fill(b.end() - m, b.end(), std::byte{'y'});
+
+            const std::string pattern(m, 'y');
+            auto p = b.find(std::span<const std::byte>{reinterpret_cast<const std::byte*>(pattern.data()), m});
+            ASSERT_TRUE(p.has_value()) << "n=" << n << " m=" << m;
+            EXPECT_EQ(*p, n - m);
+
+            auto q = b.find(std::byte{'y'});
+            ASSERT_TRUE(q.has_value());
+            EXPECT_EQ(*q, n - m);
+        }
+    }
+}
+
 TEST(Buffer, FullEmptyFree) {
     Buffer b{3};
     EXPECT_TRUE(b.empty());
@@ -377,4 +442,81 @@ TEST(Buffer, ZeroLengthViewsAreAllowedAtOrInsideSize) {
     ASSERT_TRUE(sv2.has_value());
     EXPECT_EQ(sv2->size(), 0u);
     EXPECT_EQ(sv2->data(), b.data() + 3);
-}
\ No newline at end of file
+}
+TEST(Buffer, FixedBufferDoesNotGrow) {
+    Buffer b{4};
+    EXPECT_FALSE(b.is_growable());
+    EXPECT_TRUE(b.reserve(4));
+    EXPECT_FALSE(b.reserve(5));
+    EXPECT_FALSE(b.shrink_to_fit());
+    EXPECT_FALSE(b.append(B({1, 2, 3, 4, 5})));
+    EXPECT_FALSE(b.resize(5));
+    EXPECT_EQ(b.capacity(), 4u);
+}
+
+TEST(Buffer, GrowableStartsEmptyAndGrowsOnAppend) {
+    Buffer b{sfap::growable};
+    EXPECT_TRUE(b);
+    EXPECT_TRUE(b.is_growable());
+    EXPECT_EQ(b.capacity(), 0u);
+    EXPECT_EQ(b.data(), nullptr);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_TRUE(b.push_back(static_cast<std::byte>(i)));
+    EXPECT_EQ(b.size(), 1000u);
+    EXPECT_GE(b.capacity(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(b[i], static_cast<std::byte>(i));
+
+    ASSERT_TRUE(b.append(B({7, 8, 9})));
+    EXPECT_EQ(b.size(), 1003u);
+    EXPECT_EQ(b[1002], std::byte{9});
+}
+
+TEST(Buffer, GrowableReserveIsGeometric) {
+    Buffer b{sfap::growable, 100};
+    ASSERT_EQ(b.capacity(), 100u);
+    ASSERT_TRUE(b.reserve(101));
+    EXPECT_EQ(b.capacity(), 200u);
+    ASSERT_TRUE(b.reserve(1000));
+    EXPECT_EQ(b.capacity(), 1000u);
+}
+
+TEST(Buffer, GrowableMovesToPagesAndKeepsContents) {
+    Buffer b{sfap::growable};
+    std::vector<std::byte> chunk(64 * 1024);
+    for (std::size_t i = 0; i < chunk.size(); ++i)
+        chunk[i] = static_cast<std::byte>(i * 7);
+
+    // Cross the page threshold and keep growing through mremap.
+    for (int i = 0; i < 64; ++i)
+        ASSERT_TRUE(b.append(chunk));
+    EXPECT_EQ(b.size(), 64 * chunk.size());
+    EXPECT_GE(b.capacity(), Buffer::page_growth_threshold);
+
+    for (int i = 0; i < 64; ++i)
+        ASSERT_EQ(std::memcmp(b.data() + i * chunk.size(), chunk.data(), chunk.size()), 0);
+
+    Buffer moved{std::move(b)};
+    EXPECT_TRUE(moved.is_growable());
+    EXPECT_FALSE(b.is_growable());
+    EXPECT_TRUE(moved.append(chunk));
+}
+
+TEST(Buffer, GrowableShrinkToFit) {
+    Buffer b{sfap::growable};
+    ASSERT_TRUE(b.resize(3 * Buffer::page_growth_threshold));
+    std::memset(b.data(), 0x11, b.size());
+
+    ASSERT_TRUE(b.resize(10));
+    ASSERT_TRUE(b.shrink_to_fit());
+    EXPECT_EQ(b.capacity(), 10u);
+    EXPECT_EQ(b[9], std::byte{0x11});
+
+    b.clean();
+    ASSERT_TRUE(b.shrink_to_fit());
+    EXPECT_EQ(b.capacity(), 0u);
+    EXPECT_TRUE(b);
+    EXPECT_TRUE(b.assign(B({1, 2})));
+    EXPECT_EQ(b.size(), 2u);
+}
@@ -0,0 +1,139 @@
+#include <array>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/bufferchain.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+
+using sfap::Buffer;
+using sfap::BufferChain;
+using sfap::BufferSlice;
+using sfap::SharedBuffer;
+
+namespace {
+
+Buffer buffer_of(std::string_view text) {
+    Buffer b{text.size()};
+    b.assign({reinterpret_cast<const std::byte*>(text.data()), text.size()});
+    return b;
+}
+
+BufferSlice slice_of(std::string_view text) {
+    return BufferSlice{SharedBuffer::copy_of({reinterpret_cast<const std::byte*>(text.data()), text.size()})};
+}
+
+std::string flatten(const BufferChain& chain) {
+    std::array<std::span<const std::byte>, 16> parts{};
+    std::string out;
+    for (std::size_t i = 0, n = chain.gather(parts); i < n; ++i)
+        out.append(reinterpret_cast<const char*>(parts[i].data()), parts[i].size());
+    return out;
+}
+
+} // namespace
+
+TEST(BufferChain, EmptyByDefault) {
+    BufferChain chain;
+    EXPECT_TRUE(chain.empty());
+    EXPECT_EQ(chain.segments(), 0u);
+    EXPECT_TRUE(chain.front().empty());
+    EXPECT_TRUE(chain.coalesce());
+    EXPECT_TRUE(chain.append(BufferSlice{}));
+    EXPECT_TRUE(chain.append(Buffer{0}));
+    EXPECT_EQ(chain.segments(), 0u);
+}
+
+TEST(BufferChain, AppendAndPrependLinkWithoutCopy) {
+    BufferChain chain;
+    Buffer payload = buffer_of("payload");
+    const std::byte* payload_bytes = payload.data();
+
+    ASSERT_TRUE(chain.append(slice_of("meta;")));
+    ASSERT_TRUE(chain.append(std::move(payload)));
+    ASSERT_TRUE(chain.prepend(buffer_of("HDR|")));
+
+    EXPECT_EQ(chain.segments(), 3u);
+    EXPECT_EQ(chain.size(), 16u);
+    EXPECT_EQ(flatten(chain), "HDR|meta;payload");
+
+    std::array<std::span<const std::byte>, 3> parts{};
+    ASSERT_EQ(chain.gather(parts), 3u);
+    EXPECT_EQ(parts[2].data(), payload_bytes);
+}
+
+TEST(BufferChain, GatherStopsAtOutputSize) {
+    BufferChain chain;
+    for (auto part : {"a", "b", "c"})
+        chain.append(slice_of(part));
+
+    std::array<std::span<const std::byte>, 2> parts{};
+    EXPECT_EQ(chain.gather(parts), 2u);
+}
+
+TEST(BufferChain, SpliceMovesSegments) {
+    BufferChain a;
+    BufferChain b;
+    a.append(slice_of("one "));
+    b.append(slice_of("two "));
+    b.append(slice_of("three"));
+
+    a.append(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.segments(), 0u);
+    EXPECT_EQ(a.segments(), 3u);
+    EXPECT_EQ(flatten(a), "one two three");
+
+    b.append(slice_of("again"));
+    EXPECT_EQ(flatten(b), "again");
+}
+
+TEST(BufferChain, ConsumeDropsAndNarrowsSegments) {
+    BufferChain chain;
+    chain.append(slice_of("abc"));
+    chain.append(slice_of("defg"));
+
+    chain.consume(2);
+    EXPECT_EQ(chain.segments(), 2u);
+    EXPECT_EQ(flatten(chain), "cdefg");
+
+    chain.consume(1);
+    EXPECT_EQ(chain.segments(), 1u);
+    EXPECT_EQ(flatten(chain), "defg");
+
+    chain.consume(100);
+    EXPECT_TRUE(chain.empty());
+    EXPECT_EQ(chain.segments(), 0u);
+
+    chain.append(slice_of("x"));
+    EXPECT_EQ(flatten(chain), "x");
+}
+
+TEST(BufferChain, CoalesceProducesOneSegment) {
+    BufferChain chain;
+    chain.append(slice_of("head"));
+    chain.append(slice_of("-"));
+    chain.append(slice_of("tail"));
+
+    ASSERT_TRUE(chain.coalesce());
+    EXPECT_EQ(chain.segments(), 1u);
+    EXPECT_EQ(chain.size(), 9u);
+    const auto front = chain.front();
+    EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(front.data()), front.size()), "head-tail");
+}
+
+TEST(BufferChain, MoveTransfersSegments) {
+    BufferChain chain;
+    chain.append(slice_of("moved"));
+
+    BufferChain other{std::move(chain)};
+    EXPECT_TRUE(chain.empty());
+    EXPECT_EQ(flatten(other), "moved");
+
+    chain = std::move(other);
+    EXPECT_EQ(flatten(chain), "moved");
+    EXPECT_TRUE(other.empty());
+}
@@ -0,0 +1,143 @@
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/bufferpool.hpp>
+
+using sfap::Buffer;
+using sfap::BufferPool;
+
+TEST(BufferPool, BlockSizeRoundsToPowerOfTwoClasses) {
+    EXPECT_EQ(BufferPool::block_size(0), 0u);
+    EXPECT_EQ(BufferPool::block_size(1), 4096u);
+    EXPECT_EQ(BufferPool::block_size(4096), 4096u);
+    EXPECT_EQ(BufferPool::block_size(4097), 8192u);
+    EXPECT_EQ(BufferPool::block_size(1 << 20), std::size_t{1} << 20);
+    EXPECT_EQ(BufferPool::block_size((1 << 20) + 1), 0u);
+}
+
+TEST(BufferPool, ReleasedBlockIsReused) {
+    BufferPool pool;
+    ASSERT_TRUE(pool);
+
+    std::byte* a = pool.acquire(5000);
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 1, 8192);
+    pool.release(a, 5000);
+
+    EXPECT_EQ(pool.acquire(8000), a);
+    pool.release(a, 8192);
+
+    std::byte* small = pool.acquire(100);
+    EXPECT_NE(small, a) << "a different class must not hand out the 8K block";
+    pool.release(small, 100);
+}
+
+TEST(BufferPool, StatsTrackLiveCachedAndPeak) {
+    BufferPool pool;
+    std::vector<std::byte*> blocks;
+    for (int i = 0; i < 3; ++i)
+        blocks.push_back(pool.acquire(4096));
+
+    auto s = pool.stats(0);
+    EXPECT_EQ(s.block_size, 4096u);
+    EXPECT_EQ(s.live_bytes, 3 * 4096u);
+    EXPECT_EQ(s.cached_bytes, 0u);
+    EXPECT_EQ(s.peak_bytes, 3 * 4096u);
+
+    for (auto* b : blocks)
+        pool.release(b, 4096);
+
+    s = pool.stats(0);
+    EXPECT_EQ(s.live_bytes, 0u);
+    EXPECT_EQ(s.cached_bytes, 3 * 4096u);
+    EXPECT_EQ(s.peak_bytes, 3 * 4096u);
+
+    pool.trim();
+    EXPECT_EQ(pool.stats(0).cached_bytes, 0u);
+    EXPECT_EQ(pool.stats(BufferPool::class_count).block_size, 0u);
+}
+
+TEST(BufferPool, MagazineSpillsToDepotAndDepotIsBounded) {
+    BufferPool pool{4};
+    std::vector<std::byte*> blocks;
+    for (std::size_t i = 0; i < 2 * BufferPool::magazine_size; ++i)
+        blocks.push_back(pool.acquire(4096));
+    for (auto* b : blocks)
+        pool.release(b, 4096);
+
+    // Magazine holds at most magazine_size, the depot at most 4; the rest went back to the heap.
+    const auto s = pool.stats(0);
+    EXPECT_EQ(s.live_bytes, 0u);
+    EXPECT_LE(s.cached_bytes, (BufferPool::magazine_size + 4) * 4096);
+    EXPECT_GT(s.cached_bytes, 0u);
+}
+
+TEST(BufferPool, BlocksMoveBetweenThreadsThroughDepot) {
+    BufferPool pool;
+    std::vector<std::byte*> blocks;
+    for (std::size_t i = 0; i < 4 * BufferPool::magazine_size; ++i)
+        blocks.push_back(pool.acquire(16384));
+
+    std::thread([&] {
+        for (auto* b : blocks)
+            pool.release(b, 16384);
+    }).join();
+
+    const std::set<std::byte*> released(blocks.begin(), blocks.end());
+    std::thread([&] {
+        // Another shard starts empty and refills from the depot.
+        std::byte* b = pool.acquire(16384);
+        EXPECT_TRUE(released.count(b) == 1);
+        pool.release(b, 16384);
+    }).join();
+}
+
+TEST(BufferPool, ConcurrentAcquireRelease) {
+    BufferPool pool;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 5000; ++i) {
+                const std::size_t size = 4096u << ((i + t) % 4);
+                std::byte* b = pool.acquire(size);
+                ASSERT_NE(b, nullptr);
+                b[0] = std::byte(t);
+                b[size - 1] = std::byte(t);
+                pool.release(b, size);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    for (std::size_t i = 0; i < BufferPool::class_count; ++i)
+        EXPECT_EQ(pool.stats(i).live_bytes, 0u);
+}
+
+TEST(BufferPool, BufferLeasesAndReturns) {
+    BufferPool pool;
+    {
+        Buffer b{1000, pool};
+        ASSERT_TRUE(b);
+        EXPECT_EQ(b.capacity(), 4096u);
+        EXPECT_TRUE(b.push_back(std::byte{7}));
+        EXPECT_EQ(pool.stats(0).live_bytes, 4096u);
+
+        Buffer moved{std::move(b)};
+        EXPECT_EQ(moved[0], std::byte{7});
+    }
+    EXPECT_EQ(pool.stats(0).live_bytes, 0u);
+    EXPECT_EQ(pool.stats(0).cached_bytes, 4096u);
+
+    Buffer large{(std::size_t{1} << 20) + 1, pool};
+    ASSERT_TRUE(large);
+    EXPECT_EQ(large.capacity(), (std::size_t{1} << 20) + 1);
+
+    EXPECT_FALSE(Buffer(0, pool));
+}
@@ -0,0 +1,92 @@
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/intern.hpp>
+
+using sfap::InternPool;
+
+TEST(InternPool, EqualStringsShareStorage) {
+    InternPool pool;
+    std::string first{"db1.example.com"};
+    std::string second{first};
+
+    auto a = pool.intern(first);
+    auto b = pool.intern(second);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(a->data(), b->data());
+    EXPECT_NE(a->data(), first.data());
+    EXPECT_EQ(*a, "db1.example.com");
+    EXPECT_EQ(a->data()[a->size()], '\0');
+
+    first.assign("overwritten");
+    EXPECT_EQ(*a, "db1.example.com");
+
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.bytes(), a->size() + 1);
+}
+
+TEST(InternPool, FindDoesNotInsert) {
+    InternPool pool;
+    EXPECT_FALSE(pool.find("missing"));
+    EXPECT_EQ(pool.size(), 0u);
+
+    auto a = pool.intern("present");
+    auto found = pool.find("present");
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->data(), a->data());
+}
+
+TEST(InternPool, EmptyAndLongStrings) {
+    InternPool pool;
+    auto empty = pool.intern({});
+    ASSERT_TRUE(empty);
+    EXPECT_TRUE(empty->empty());
+    EXPECT_EQ(empty->data()[0], '\0');
+
+    const std::string long_text(InternPool::chunk_size * 2, 'h');
+    auto a = pool.intern(long_text);
+    auto small = pool.intern("after");
+    ASSERT_TRUE(a && small);
+    EXPECT_EQ(*a, long_text);
+    EXPECT_EQ(*small, "after");
+    EXPECT_EQ(pool.intern(long_text)->data(), a->data());
+}
+
+TEST(InternPool, ViewsStayStableWhileGrowing) {
+    InternPool pool;
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 5000; ++i)
+        views.push_back(*pool.intern("host-" + std::to_string(i) + ".example"));
+
+    EXPECT_EQ(pool.size(), 5000u);
+    for (int i = 0; i < 5000; ++i) {
+        const std::string expected{"host-" + std::to_string(i) + ".example"};
+        ASSERT_EQ(views[i], expected);
+        ASSERT_EQ(pool.find(expected)->data(), views[i].data());
+    }
+}
+
+TEST(InternPool, ConcurrentInternsAgree) {
+    InternPool pool;
+    constexpr int thread_count{4};
+    constexpr int names{1000};
+    std::vector<std::vector<const char*>> seen(thread_count, std::vector<const char*>(names));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < names; ++i)
+                seen[t][i] = pool.intern("node" + std::to_string(i))->data();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(pool.size(), static_cast<std::size_t>(names));
+    for (int t = 1; t < thread_count; ++t)
+        EXPECT_EQ(seen[t], seen[0]);
+}
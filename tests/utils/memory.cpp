@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/memory.hpp>
+#include <sfap/utils/ringbuffer.hpp>
+
+using sfap::Buffer;
+using sfap::MemoryOptions;
+using sfap::RingBuffer;
+
+using Pages = MemoryOptions::Pages;
+
+TEST(Memory, HugePageSizeIsPowerOfTwo) {
+    EXPECT_TRUE(std::has_single_bit(sfap::huge_page_size()));
+}
+
+TEST(Memory, ZeroSizeIsRejected) {
+    EXPECT_FALSE(sfap::allocate_pages(0));
+}
+
+TEST(Memory, DefaultPagesAreZeroedAndWritable) {
+    auto pages = sfap::allocate_pages(10000);
+    ASSERT_TRUE(pages);
+    EXPECT_GE(pages->size(), 10000u);
+    EXPECT_TRUE(std::all_of(pages->begin(), pages->end(), [](std::byte b) { return b == std::byte{0}; }));
+
+    std::memset(pages->data(), 0x7F, pages->size());
+    EXPECT_EQ((*pages)[pages->size() - 1], std::byte{0x7F});
+    sfap::release_pages(*pages);
+}
+
+TEST(Memory, HugePagesRoundToHugePageSizeWithFallback) {
+    for (auto policy : {Pages::TRANSPARENT_HUGE, Pages::HUGE}) {
+        auto pages = sfap::allocate_pages(1, {.pages = policy, .prefault = true});
+        ASSERT_TRUE(pages);
+        EXPECT_EQ(pages->size(), sfap::huge_page_size());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pages->data()) % sfap::huge_page_size(), 0u);
+        (*pages)[0] = std::byte{1};
+        sfap::release_pages(*pages);
+    }
+}
+
+TEST(Memory, NumaBindingToMissingNodeFails) {
+    EXPECT_FALSE(sfap::allocate_pages(4096, {.numa_node = 1023}));
+
+    auto pages = sfap::allocate_pages(4096, {.numa_node = 0, .prefault = true});
+    if (!pages && pages.error().code() == ENOSYS)
+        GTEST_SKIP() << "kernel without NUMA support";
+    ASSERT_TRUE(pages);
+    sfap::release_pages(*pages);
+}
+
+TEST(Memory, BufferWithOptions) {
+    Buffer buffer{100, MemoryOptions{.prefault = true}};
+    ASSERT_TRUE(buffer);
+    EXPECT_GE(buffer.capacity(), 100u);
+    EXPECT_TRUE(buffer.push_back(std::byte{42}));
+
+    Buffer moved{std::move(buffer)};
+    EXPECT_FALSE(buffer);
+    EXPECT_EQ(moved[0], std::byte{42});
+
+    moved = Buffer{16};
+    EXPECT_EQ(moved.capacity(), 16u);
+
+    EXPECT_FALSE(Buffer(0, MemoryOptions{}));
+}
+
+TEST(Memory, RingBufferWithOptions) {
+    EXPECT_FALSE(RingBuffer(1000, MemoryOptions{}));
+
+    RingBuffer rb{1 << 22, {.pages = Pages::TRANSPARENT_HUGE, .prefault = true}};
+    ASSERT_TRUE(rb);
+    EXPECT_EQ(rb.capacity(), std::size_t{1} << 22);
+
+    RingBuffer small{64, MemoryOptions{}};
+    ASSERT_TRUE(small);
+    EXPECT_TRUE(std::has_single_bit(small.capacity()));
+    EXPECT_GE(small.capacity(), 64u);
+
+    for (int i = 0; i < 100; ++i)
+        ASSERT_TRUE(small.put(std::byte(i)));
+    std::byte c{};
+    ASSERT_TRUE(small.pop(c));
+    EXPECT_EQ(c, std::byte{0});
+
+    RingBuffer moved{std::move(small)};
+    EXPECT_EQ(moved.size(), 99u);
+}
+
+TEST(Memory, ResizePagesKeepsContents) {
+    auto pages = sfap::allocate_pages(4096);
+    ASSERT_TRUE(pages);
+    std::memset(pages->data(), 0x33, pages->size());
+
+    auto grown = sfap::resize_pages(*pages, std::size_t{8} << 20);
+    ASSERT_TRUE(grown);
+    EXPECT_GE(grown->size(), std::size_t{8} << 20);
+    EXPECT_EQ((*grown)[4095], std::byte{0x33});
+    EXPECT_EQ((*grown)[4096], std::byte{0});
+
+    auto shrunk = sfap::resize_pages(*grown, 100);
+    ASSERT_TRUE(shrunk);
+    EXPECT_EQ((*shrunk)[99], std::byte{0x33});
+    sfap::release_pages(*shrunk);
+
+    EXPECT_FALSE(sfap::resize_pages(*shrunk, 0));
+}
@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/mpringbuffer.hpp>
+
+using sfap::MpmcRingBuffer;
+using sfap::MpscRingBuffer;
+
+namespace {
+
+struct Message {
+    std::uint32_t producer;
+    std::uint32_t sequence;
+};
+
+template <class Ring> bool write_message(Ring& ring, const Message& message, std::size_t length) {
+    auto record = ring.prepare_write(length);
+    if (!record)
+        return false;
+    std::memset(record.data.data(), 0x5A, record.data.size());
+    std::memcpy(record.data.data(), &message, sizeof(message));
+    return ring.commit_write(record);
+}
+
+} // namespace
+
+TEST(MpRingBuffer, ConstructRequiresPowerOfTwoAndBlock) {
+    EXPECT_TRUE(MpscRingBuffer{1024});
+    EXPECT_FALSE(MpscRingBuffer{1000});
+    EXPECT_FALSE(MpscRingBuffer{32});
+
+    MpmcRingBuffer rb{4096};
+    ASSERT_TRUE(rb);
+    EXPECT_EQ(rb.capacity(), 4096u);
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST(MpRingBuffer, RecordRoundTrip) {
+    MpscRingBuffer rb{1024};
+
+    auto w = rb.prepare_write(10);
+    ASSERT_TRUE(w);
+    EXPECT_EQ(w.data.size(), 10u);
+    std::memcpy(w.data.data(), "0123456789", 10);
+    EXPECT_FALSE(rb.empty());
+
+    EXPECT_FALSE(rb.prepare_read()) << "uncommitted record must not be visible";
+    ASSERT_TRUE(rb.commit_write(w));
+
+    auto r = rb.prepare_read();
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r.data.size(), 10u);
+    EXPECT_EQ(std::memcmp(r.data.data(), "0123456789", 10), 0);
+    EXPECT_TRUE(rb.commit_read(r));
+
+    EXPECT_TRUE(rb.empty());
+    EXPECT_FALSE(rb.prepare_read());
+}
+
+TEST(MpRingBuffer, RejectsOversizedAndEmptyRecords) {
+    MpscRingBuffer rb{256};
+
+    EXPECT_FALSE(rb.prepare_write(0));
+    EXPECT_FALSE(rb.prepare_write(257));
+    EXPECT_TRUE(rb.prepare_write(256));
+}
+
+TEST(MpRingBuffer, FullRingRejectsUntilReleased) {
+    MpscRingBuffer rb{256};
+
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(rb.commit_write(rb.prepare_write(64)));
+    EXPECT_FALSE(rb.prepare_write(1));
+
+    auto r = rb.prepare_read();
+    ASSERT_TRUE(r);
+    EXPECT_FALSE(rb.prepare_write(1)) << "claimed but unreleased record still holds space";
+
+    rb.commit_read(r);
+    EXPECT_TRUE(rb.prepare_write(64));
+}
+
+TEST(MpRingBuffer, WrapInsertsPaddingAndKeepsRecordsContiguous) {
+    MpscRingBuffer rb{256};
+
+    ASSERT_TRUE(rb.commit_write(rb.prepare_write(150)));
+    rb.commit_read(rb.prepare_read());
+
+    // 3 blocks used; a 2-block record does not fit in the last block.
+    auto w = rb.prepare_write(100);
+    ASSERT_TRUE(w);
+    EXPECT_EQ(w.data.size(), 100u);
+    std::fill(w.data.begin(), w.data.end(), std::byte{0x42});
+    rb.commit_write(w);
+
+    auto r = rb.prepare_read();
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r.data.size(), 100u);
+    EXPECT_TRUE(std::all_of(r.data.begin(), r.data.end(), [](std::byte b) { return b == std::byte{0x42}; }));
+    rb.commit_read(r);
+    EXPECT_TRUE(rb.empty());
+}
+
+namespace {
+
+template <class Ring> void write_large_record_after_head_moved() {
+    Ring rb{512};
+
+    // Head at block 4 of 8: a 5-block record needs 4 blocks of padding first.
+    ASSERT_TRUE(rb.commit_write(rb.prepare_write(4 * Ring::block_size)));
+    rb.commit_read(rb.prepare_read());
+    ASSERT_TRUE(rb.empty());
+
+    auto w = rb.prepare_write(5 * Ring::block_size);
+    ASSERT_TRUE(w) << "record within capacity refused on an empty ring";
+    std::fill(w.data.begin(), w.data.end(), std::byte{0x17});
+    rb.commit_write(w);
+    EXPECT_FALSE(rb.prepare_write(1));
+
+    auto r = rb.prepare_read();
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r.data.size(), 5 * Ring::block_size);
+    EXPECT_TRUE(std::all_of(r.data.begin(), r.data.end(), [](std::byte b) { return b == std::byte{0x17}; }));
+    rb.commit_read(r);
+    EXPECT_TRUE(rb.empty());
+    EXPECT_TRUE(rb.prepare_write(rb.capacity()));
+}
+
+} // namespace
+
+TEST(MpRingBuffer, RecordOverHalfCapacityFitsEmptyRingAtAnyHead) {
+    write_large_record_after_head_moved<MpscRingBuffer>();
+    write_large_record_after_head_moved<MpmcRingBuffer>();
+}
+
+TEST(MpRingBuffer, OutOfOrderCommitBlocksReaderUntilOlderCommitted) {
+    MpscRingBuffer rb{1024};
+
+    auto first = rb.prepare_write(8);
+    auto second = rb.prepare_write(8);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    rb.commit_write(second);
+    EXPECT_FALSE(rb.prepare_read());
+
+    rb.commit_write(first);
+    auto r1 = rb.prepare_read();
+    auto r2 = rb.prepare_read();
+    ASSERT_TRUE(r1);
+    ASSERT_TRUE(r2);
+    EXPECT_EQ(r1.data.data(), first.data.data());
+    EXPECT_EQ(r2.data.data(), second.data.data());
+
+    rb.commit_read(r2);
+    EXPECT_FALSE(rb.empty()) << "space is returned only after older records are released";
+    rb.commit_read(r1);
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST(MpRingBuffer, MpscManyProducersKeepPerProducerOrder) {
+    MpscRingBuffer rb{4096};
+    constexpr std::uint32_t producers = 4;
+    constexpr std::uint32_t per_producer = 20'000;
+
+    std::barrier start{producers + 1};
+    std::vector<std::thread> threads;
+    for (std::uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            start.arrive_and_wait();
+            for (std::uint32_t i = 0; i < per_producer; ++i) {
+                while (!write_message(rb, {p, i}, sizeof(Message) + (i % 5) * 40))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    start.arrive_and_wait();
+    std::vector<std::uint32_t> next(producers, 0);
+    std::size_t received = 0;
+    while (received < producers * per_producer) {
+        auto r = rb.prepare_read();
+        if (!r) {
+            std::this_thread::yield();
+            continue;
+        }
+        Message m{};
+        std::memcpy(&m, r.data.data(), sizeof(m));
+        ASSERT_LT(m.producer, producers);
+        EXPECT_EQ(m.sequence, next[m.producer]);
+        EXPECT_EQ(r.data.size(), sizeof(Message) + (m.sequence % 5) * 40);
+        next[m.producer] = m.sequence + 1;
+        rb.commit_read(r);
+        ++received;
+    }
+
+    for (auto& t : threads)
+        t.join();
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST(MpRingBuffer, MpmcDeliversEveryRecordExactlyOnce) {
+    MpmcRingBuffer rb{4096};
+    constexpr std::uint32_t producers = 3;
+    constexpr std::uint32_t consumers = 3;
+    constexpr std::uint32_t per_producer = 20'000;
+
+    std::barrier start{producers + consumers};
+    std::atomic<std::uint32_t> consumed{0};
+    std::vector<std::atomic<std::uint32_t>> seen(producers * per_producer);
+    std::vector<std::thread> threads;
+
+    for (std::uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            start.arrive_and_wait();
+            for (std::uint32_t i = 0; i < per_producer; ++i) {
+                while (!write_message(rb, {p, i}, sizeof(Message) + (i % 3) * 64))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (std::uint32_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            start.arrive_and_wait();
+            while (consumed.load() < producers * per_producer) {
+                auto r = rb.prepare_read();
+                if (!r) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                Message m{};
+                std::memcpy(&m, r.data.data(), sizeof(m));
+                seen[m.producer * per_producer + m.sequence].fetch_add(1);
+                rb.commit_read(r);
+                consumed.fetch_add(1);
+            }
+        });
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    EXPECT_EQ(consumed.load(), producers * per_producer);
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](const auto& n) { return n.load() == 1; }));
+    EXPECT_TRUE(rb.empty());
+}
@@ -1,12 +1,17 @@
 #include <atomic>
 #include <barrier>
+#include <coroutine>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <cstring>
 
 #include <gtest/gtest.h>
 
+#include <sfap/utils/executor.hpp>
 #include <sfap/utils/ringbuffer.hpp>
+#include <sfap/utils/task.hpp>
 
 using sfap::RingBuffer;
 
@@ -272,4 +277,145 @@ TEST_F(RingBufferTest, SpscProducerConsumerMany) {
     EXPECT_EQ(produced.load(), N);
     EXPECT_EQ(consumed.load(), N);
     EXPECT_TRUE(rb.empty());
-}
\ No newline at end of file
+}
+namespace {
+
+class QueueExecutor final : public sfap::Executor {
+  public:
+    void post(std::coroutine_handle<> h) noexcept override {
+        std::lock_guard lock{mutex_};
+        queue_.push_back(h);
+    }
+
+    std::size_t run_pending() {
+        std::vector<std::coroutine_handle<>> batch;
+        {
+            std::lock_guard lock{mutex_};
+            batch.swap(queue_);
+        }
+        for (auto h : batch)
+            h.resume();
+        return batch.size();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::coroutine_handle<>> queue_;
+};
+
+} // namespace
+
+TEST_F(RingBufferTest, ReadableReadyDoesNotSuspend) {
+    RingBuffer rb{8};
+    ASSERT_TRUE(rb.put(B(1)));
+
+    bool done = false;
+    auto coro = [&]() -> sfap::task<void> {
+        const std::size_t n = co_await rb.readable(1);
+        EXPECT_EQ(n, 1u);
+        done = true;
+    };
+
+    auto t = coro();
+    t.start_detached();
+    EXPECT_TRUE(done);
+}
+
+TEST_F(RingBufferTest, ReadableResumesInlineWhenEnoughCommitted) {
+    RingBuffer rb{8};
+
+    std::size_t seen = 0;
+    auto coro = [&]() -> sfap::task<void> {
+        seen = co_await rb.readable(4);
+        std::byte x{};
+        while (rb.pop(x)) {
+        }
+    };
+
+    auto t = coro();
+    t.start_detached();
+    EXPECT_EQ(seen, 0u);
+
+    ASSERT_TRUE(rb.put(B(1)));
+    ASSERT_TRUE(rb.put(B(2)));
+    EXPECT_EQ(seen, 0u) << "woken before the requested amount was available";
+
+    auto w = rb.prepare_write(2);
+    ASSERT_EQ(RingBuffer::view_size(w), 2u);
+    rb.commit_write(2);
+
+    EXPECT_EQ(seen, 4u);
+    EXPECT_TRUE(rb.empty());
+}
+
+TEST_F(RingBufferTest, WritableResumesWhenConsumerFreesSpace) {
+    RingBuffer rb{4};
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(rb.put(B(i)));
+
+    std::size_t seen = 0;
+    auto coro = [&]() -> sfap::task<void> { seen = co_await rb.writable(2); };
+
+    auto t = coro();
+    t.start_detached();
+    EXPECT_EQ(seen, 0u);
+
+    std::byte x{};
+    ASSERT_TRUE(rb.pop(x));
+    EXPECT_EQ(seen, 0u);
+    ASSERT_TRUE(rb.pop(x));
+    EXPECT_EQ(seen, 2u);
+}
+
+TEST_F(RingBufferTest, WaiterResumedThroughExecutorAcrossThreads) {
+    RingBuffer rb{1024};
+    QueueExecutor executor;
+    constexpr std::size_t total = 200'000;
+
+    std::atomic<bool> done{false};
+    std::size_t received = 0;
+
+    auto consumer = [&]() -> sfap::task<void> {
+        while (received < total) {
+            co_await rb.readable(1, &executor);
+            auto r = rb.prepare_read(rb.capacity());
+            for (auto b : r.first)
+                EXPECT_EQ(b, B(static_cast<uint8_t>(received++)));
+            for (auto b : r.second)
+                EXPECT_EQ(b, B(static_cast<uint8_t>(received++)));
+            rb.commit_read(RingBuffer::view_size(r));
+        }
+        done.store(true);
+    };
+
+    auto producer = [&]() -> sfap::task<void> {
+        std::size_t sent = 0;
+        while (sent < total) {
+            co_await rb.writable(1);
+            auto w = rb.prepare_write(total - sent);
+            for (auto& b : w.first)
+                b = B(static_cast<uint8_t>(sent++));
+            for (auto& b : w.second)
+                b = B(static_cast<uint8_t>(sent++));
+            rb.commit_write(RingBuffer::view_size(w));
+        }
+    };
+
+    auto c = consumer();
+    c.start_detached();
+
+    std::thread producer_thread([&] {
+        auto p = producer();
+        p.start_detached();
+        while (!done.load())
+            std::this_thread::yield();
+    });
+
+    while (!done.load()) {
+        if (executor.run_pending() == 0)
+            std::this_thread::yield();
+    }
+
+    producer_thread.join();
+    EXPECT_EQ(received, total);
+}
@@ -0,0 +1,116 @@
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/buffer.hpp>
+#include <sfap/utils/sharedbuffer.hpp>
+
+using sfap::Buffer;
+using sfap::BufferSlice;
+using sfap::SharedBuffer;
+
+namespace {
+
+SharedBuffer make(const char* text) {
+    return SharedBuffer::copy_of({reinterpret_cast<const std::byte*>(text), std::strlen(text)});
+}
+
+} // namespace
+
+TEST(SharedBuffer, NullByDefault) {
+    SharedBuffer s;
+    EXPECT_FALSE(s);
+    EXPECT_EQ(s.size(), 0u);
+    EXPECT_EQ(s.data(), nullptr);
+    EXPECT_EQ(s.use_count(), 0u);
+    EXPECT_FALSE(s.slice(0, 0));
+    EXPECT_FALSE(SharedBuffer::copy_of({}));
+}
+
+TEST(SharedBuffer, AdoptsBufferWithoutCopy) {
+    Buffer b{16};
+    ASSERT_TRUE(b.append(std::span<const std::byte>{reinterpret_cast<const std::byte*>("chunk"), 5}));
+    const std::byte* bytes = b.data();
+
+    SharedBuffer s{std::move(b)};
+    ASSERT_TRUE(s);
+    EXPECT_FALSE(b);
+    EXPECT_EQ(s.data(), bytes);
+    EXPECT_EQ(s.size(), 5u);
+}
+
+TEST(SharedBuffer, CopiesShareAndCountReferences) {
+    SharedBuffer a = make("replicated");
+    EXPECT_EQ(a.use_count(), 1u);
+    {
+        SharedBuffer b{a};
+        SharedBuffer c;
+        c = b;
+        EXPECT_EQ(a.use_count(), 3u);
+        EXPECT_EQ(c.data(), a.data());
+
+        SharedBuffer d{std::move(c)};
+        EXPECT_FALSE(c);
+        EXPECT_EQ(a.use_count(), 3u);
+    }
+    EXPECT_EQ(a.use_count(), 1u);
+
+    a = SharedBuffer{};
+    EXPECT_FALSE(a);
+}
+
+TEST(SharedBuffer, SlicesKeepBytesAlive) {
+    std::optional<BufferSlice> slice;
+    {
+        SharedBuffer s = make("header:body");
+        slice = s.slice(7, 4);
+        ASSERT_TRUE(slice);
+        EXPECT_EQ(s.use_count(), 2u);
+    }
+
+    ASSERT_TRUE(*slice);
+    EXPECT_EQ(slice->buffer().use_count(), 1u);
+    ASSERT_EQ(slice->size(), 4u);
+    EXPECT_EQ(std::memcmp(slice->data(), "body", 4), 0);
+
+    auto sub = slice->subslice(1, 2);
+    ASSERT_TRUE(sub);
+    EXPECT_EQ(std::memcmp(sub->view().data(), "od", 2), 0);
+    EXPECT_FALSE(slice->subslice(3, 2));
+    EXPECT_TRUE(slice->subslice(4, 0));
+}
+
+TEST(SharedBuffer, SliceBoundsAreChecked) {
+    SharedBuffer s = make("abc");
+    EXPECT_TRUE(s.slice(0, 3));
+    EXPECT_TRUE(s.slice(3, 0));
+    EXPECT_FALSE(s.slice(4, 0));
+    EXPECT_FALSE(s.slice(1, 3));
+
+    BufferSlice whole{s};
+    EXPECT_EQ(whole.size(), 3u);
+    EXPECT_EQ(whole.data(), s.data());
+
+    BufferSlice empty;
+    EXPECT_FALSE(empty);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.view().empty());
+}
+
+TEST(SharedBuffer, ConcurrentCopiesReleaseOnce) {
+    SharedBuffer s = make("fan-out");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([slice = BufferSlice{s}] {
+            for (int i = 0; i < 10000; ++i) {
+                BufferSlice copy{slice};
+                EXPECT_EQ(copy.size(), 7u);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_EQ(s.use_count(), 1u);
+}
@@ -49,4 +49,60 @@ TEST(String, View) {
     const auto view = s.view();
 
     EXPECT_EQ(std::string{view}, "giggity");
-}
\ No newline at end of file
+}
+
+TEST(String, ShortStringsAreStoredInline) {
+    const std::string_view host{"db1.internal"};
+    String s{host};
+
+    EXPECT_LE(sizeof(String), 4 * sizeof(void*));
+    EXPECT_EQ(s.capacity(), String::inline_capacity);
+    EXPECT_EQ(s.view(), host);
+    EXPECT_GE(s.c_str(), reinterpret_cast<const char*>(&s));
+    EXPECT_LT(s.c_str(), reinterpret_cast<const char*>(&s + 1));
+    EXPECT_EQ(s.c_str()[s.size()], '\0');
+
+    EXPECT_TRUE(s.append(".example"));
+    EXPECT_EQ(s.view(), "db1.internal.example");
+}
+
+TEST(String, LongStringsUseHeap) {
+    const std::string text(String::inline_capacity + 1, 'x');
+    String s{std::string_view{text}};
+
+    EXPECT_EQ(s.size(), text.size());
+    EXPECT_EQ(s.capacity(), text.size());
+    EXPECT_TRUE(s.c_str() < reinterpret_cast<const char*>(&s) || s.c_str() >= reinterpret_cast<const char*>(&s + 1));
+    EXPECT_STREQ(s.c_str(), text.c_str());
+}
+
+TEST(String, MoveKeepsContentsForInlineAndHeap) {
+    String small{"short"};
+    String moved_small{std::move(small)};
+    EXPECT_FALSE(small);
+    EXPECT_STREQ(moved_small.c_str(), "short");
+    EXPECT_NE(moved_small.c_str(), small.c_str());
+
+    const std::string text(64, 'y');
+    String large{std::string_view{text}};
+    const char* heap = large.c_str();
+    String moved_large{std::move(large)};
+    EXPECT_FALSE(large);
+    EXPECT_EQ(moved_large.c_str(), heap);
+
+    moved_large = std::move(moved_small);
+    EXPECT_STREQ(moved_large.c_str(), "short");
+    EXPECT_EQ(moved_large.c_str()[5], '\0');
+
+    String copy{moved_large};
+    EXPECT_STREQ(copy.c_str(), "short");
+    EXPECT_NE(copy.c_str(), moved_large.c_str());
+}
+
+TEST(String, InlineCapacityBoundary) {
+    const std::string exact(String::inline_capacity, 'z');
+    String s{exact.c_str()};
+    EXPECT_EQ(s.capacity(), String::inline_capacity);
+    EXPECT_EQ(s.view(), exact);
+    EXPECT_FALSE(s.push_back('z'));
+}
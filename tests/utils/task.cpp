@@ -0,0 +1,103 @@
+#include <coroutine>
+#include <utility>
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include <sfap/utils/task.hpp>
+
+namespace {
+
+sfap::task<std::size_t> one() noexcept {
+    co_return 1;
+}
+
+sfap::task<std::size_t> loop(std::size_t count) noexcept {
+    std::size_t sum{};
+    for (std::size_t i = 0; i < count; ++i)
+        sum += co_await one();
+    co_return sum;
+}
+
+sfap::task<std::size_t> nested(std::size_t depth) noexcept {
+    if (depth == 0)
+        co_return 0;
+    co_return 1 + co_await nested(depth - 1);
+}
+
+/// \brief Suspends until the test resumes the stored handle.
+struct Gate {
+    std::coroutine_handle<>& waiting;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<> h) noexcept {
+        waiting = h;
+    }
+    void await_resume() const noexcept {}
+};
+
+/// \brief AddressSanitizer keeps GCC from turning symmetric transfer into a tail call.
+constexpr bool tail_calls{
+#if defined(__SANITIZE_ADDRESS__)
+    false
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+    false
+#else
+    true
+#endif
+#else
+    true
+#endif
+};
+
+std::size_t run(sfap::task<std::size_t> task) {
+    std::size_t out{};
+    auto body = [&]() -> sfap::task<void> { out = co_await task; };
+    auto driver = body();
+    driver.start_detached();
+    return out;
+}
+
+} // namespace
+
+// Each await used to resume the awaited task and then its continuation from
+// inside await_suspend(), so every synchronous completion nested stack frames.
+TEST(Task, SynchronousAwaitLoopRunsInConstantStack) {
+    if (!tail_calls)
+        GTEST_SKIP() << "AddressSanitizer disables sibling calls";
+    EXPECT_EQ(run(loop(10'000'000)), 10'000'000u);
+}
+
+TEST(Task, DeepNestedChainRunsInConstantStack) {
+    if (!tail_calls)
+        GTEST_SKIP() << "AddressSanitizer disables sibling calls";
+    EXPECT_EQ(run(nested(100'000)), 100'000u);
+}
+
+TEST(Task, ResumesContinuationAfterSuspension) {
+    std::coroutine_handle<> waiting;
+    bool done{};
+    auto inner = [&]() -> sfap::task<void> { co_await Gate{waiting}; };
+    auto outer = [&]() -> sfap::task<void> {
+        co_await inner();
+        done = true;
+    };
+
+    auto task = outer();
+    task.start_detached();
+    ASSERT_TRUE(waiting);
+    EXPECT_FALSE(done);
+
+    waiting.resume();
+    EXPECT_TRUE(done);
+}
+
+TEST(Task, DetachedTaskWithoutContinuationStops) {
+    auto task = one();
+    task.start_detached();
+    EXPECT_EQ(run(std::move(task)), 1u);
+}